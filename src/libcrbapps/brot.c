@@ -48,10 +48,16 @@
 #include <config.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <assert.h>
 #include <float.h>
 #include <math.h>
 #include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 #include <libcrbbasic/crbbasic.h>
 #include <libcrbbrot/crbbrot.h>
 #include <libcrbrna/crbrna.h>
@@ -60,6 +66,85 @@
 
 #define GAS_CONST 8.314472
 #define COLLATE_THRESH 0.99
+#define DOMAIN_PRESET_PROB 0.9f   /* start prob. of domain bases */
+#define DOMAIN_REFINE_TEMP 0.5f   /* share of -t for the global refinement */
+#define HELIX_LOOP_TEMP 0.5f      /* share of -t for releasing loops */
+#define HELIX_LOOP_STEPS 0.5f     /* share of -s for releasing loops */
+#define CACHE_PREFIX "brot-"      /* names of design cache entries */
+#define CACHE_FORMAT "6"          /* bump on changes affecting designs */
+
+/* a domain of a decomposed structure: the part of the structure closed by
+   a stem of the external loop */
+typedef struct {
+      unsigned long start;        /* first position in the whole structure */
+      unsigned long size;
+      Scmf_Rna_Opt_data* data;
+      SeqMatrix* sm;
+      int error;
+} BrotDomain;
+
+/* energy parameters as read, with enthalpies if given. Scorings for all
+   temperatures of a run are derived from them. */
+typedef struct {
+      NN_scores* free_energy;
+      NN_scores* enthalpy;
+} BrotParams;
+
+/* scoring data of a run: set up once and shared read-only by all
+   simulations, i.e. the domains of a structure */
+typedef struct {
+      enum enum_scoring scoring;
+      void* scores;               /* NN_scores or Nussinov scoring matrix */
+      char** bp_allowed;          /* allowed pairing partners of each base */
+      const NN_scores* derived;   /* shared parameters at the temperature */
+      float temperature;
+      Rng rng;                    /* random stream of this scoring */
+} BrotScoring;
+
+#ifdef HAVE_PTHREAD
+/* domains shared by the threads designing them */
+typedef struct {
+      BrotDomain* list;
+      unsigned long n;
+      unsigned long next;         /* next domain to be designed */
+      struct brot_args_info* brot_args;
+      BrotScoring* scoring;
+      const Rna* rna;
+      const SeqMatrix* sm;
+      pthread_mutex_t lock;
+} BrotDomainQueue;
+#endif
+
+/* a target structure of a batch run */
+typedef struct {
+      char* name;                 /* name given in the file or its number */
+      char* structure;            /* bracket notation */
+      unsigned long size;
+      char* seq;                  /* designed sequence */
+      float temperature;          /* temperature to design for */
+      BrotScoring* scoring;
+      double secs;                /* wall clock time spent on the design */
+      int error;
+      bool done;
+} BrotTarget;
+
+/* targets of a batch run, shared by the threads designing them */
+typedef struct {
+      BrotTarget* list;
+      unsigned long n;
+      BrotTarget** order;         /* order of design: longest first */
+      unsigned long next;         /* next target to be designed */
+      unsigned long next_out;     /* next target to be written */
+      struct brot_args_info* brot_args;
+      BrotParams* params;         /* parameters the scorings derive from */
+      BrotScoring** scoring;      /* one per temperature */
+      unsigned long n_scoring;
+      int error;
+#ifdef HAVE_PTHREAD
+      pthread_mutex_t lock;
+      pthread_mutex_t cache_lock;
+#endif
+} BrotBatch;
 
 static const char NN_2_SMALL_WARNING[] = "Nearest Neighbour model can only be used with "
                              "structures of size greater than 1, size of "
@@ -70,13 +155,35 @@ brot_cmdline_parser_postprocess (const struct brot_args_info* args_info,
                                  const char* cmdline)
 {
    /* check input structure */
-   if (args_info->inputs_num == 1)
+   if (args_info->batch_given)
+   {
+      if (args_info->inputs_num != 1)
+      {
+         THROW_ERROR_MSG ("No RNA structure allowed as argument together "
+                          "with option \"--batch\", try `%s --help` for "
+                          "more information.", get_progname());
+         return 1;
+      }
+      if (  args_info->file_given
+          ||args_info->fixed_nuc_given
+          ||args_info->seed_sequence_given
+          ||args_info->entropy_output_given
+          ||args_info->simulation_output_given)
+      {
+         THROW_ERROR_MSG ("Option \"--batch\" can not be combined with "
+                          "options \"--file\", \"--fixed-nuc\", "
+                          "\"--seed-sequence\", \"--entropy-output\" and "
+                          "\"--simulation-output\".");
+         return 1;
+      }
+   }
+   else if (args_info->inputs_num == 1)
    {
       THROW_ERROR_MSG ("RNA structure required as argument, try "
                        "`%s --help` for more information.", get_progname());
       return 1;
    }
-   if (args_info->inputs_num != 2)
+   else if (args_info->inputs_num != 2)
    {
       THROW_ERROR_MSG ("Only one RNA structure allowed as argument, try "
                        "`%s --help` for more information.", get_progname());
@@ -86,13 +193,19 @@ brot_cmdline_parser_postprocess (const struct brot_args_info* args_info,
    if (args_info->verbose_given)
    {
       enable_verbose_messaging();
-      print_verbose ("# This is %s %s out of the %s\n# %s\n"
-                     "# Input structure: %s\n",
+      print_verbose ("# This is %s %s out of the %s\n# %s\n",
                      BROT_CMDLINE_PARSER_PACKAGE,
                      BROT_CMDLINE_PARSER_VERSION,
                      PACKAGE_STRING,
-                     cmdline,
-                     args_info->inputs[1]);
+                     cmdline);
+      if (args_info->batch_given)
+      {
+         print_verbose ("# Input file: %s\n", args_info->batch_arg);
+      }
+      else
+      {
+         print_verbose ("# Input structure: %s\n", args_info->inputs[1]);
+      }
    }
 
    /* check steps */
@@ -132,7 +245,8 @@ brot_cmdline_parser_postprocess (const struct brot_args_info* args_info,
          return 1;         
       }
 
-      if ((unsigned) args_info->window_size_arg > (strlen (args_info->inputs[1])/2 - 1))
+      if ((!args_info->batch_given)
+          && ((unsigned) args_info->window_size_arg > (strlen (args_info->inputs[1])/2 - 1)))
       {
          THROW_ERROR_MSG ("Option \"--window_size\" must be less than or equal to half of the size of the input structure. Is: \"%ld\", allowed: \"%lu\"",
                           args_info->window_size_arg, (unsigned long) strlen (args_info->inputs[1])/2 - 1);
@@ -159,6 +273,118 @@ brot_cmdline_parser_postprocess (const struct brot_args_info* args_info,
    print_verbose ("# Min. cool. factor       (-j): %.2f\n",
                   args_info->min_cool_arg);
 
+   /* check number of threads */
+   if (args_info->threads_arg < 1)
+   {
+      THROW_ERROR_MSG ("Option \"--threads\" requires positive integer as "
+                       "argument, found: %ld", args_info->threads_arg);
+      return 1;
+   }
+   print_verbose ("# Threads                 (-T): %ld\n",
+                  args_info->threads_arg);
+
+   /* check seeding */
+   if (args_info->seed_sequence_given)
+   {
+      if (  (args_info->seed_confidence_arg <= 0.0f)
+          ||(args_info->seed_confidence_arg >= 1.0f))
+      {
+         THROW_ERROR_MSG ("Option \"--seed-confidence\" requires a value "
+                          "between 0 and 1, found: %.2f",
+                          args_info->seed_confidence_arg);
+         return 1;
+      }
+      if (args_info->seed_temp_arg <= 0.0f)
+      {
+         THROW_ERROR_MSG ("Option \"--seed-temp\" requires positive value, "
+                          "found: %.2f", args_info->seed_temp_arg);
+         return 1;
+      }
+      print_verbose ("# Seed sequence           (-S): %s\n",
+                     args_info->seed_sequence_arg);
+      print_verbose ("# Seed confidence         (-P): %.2f\n",
+                     args_info->seed_confidence_arg);
+      print_verbose ("# Seeded start-temp.      (-I): %.2f\n",
+                     args_info->seed_temp_arg);
+   }
+
+   /* check energy parameters */
+   if (args_info->energy_params_given)
+   {
+      if (args_info->scoring_arg == scoring_arg_nussinov)
+      {
+         THROW_ERROR_MSG ("Option \"--energy-params\" only works with the "
+                          "\"NN\" and \"simpleNN\" scoring schemes.");
+         return 1;
+      }
+      print_verbose ("# Energy parameters       (-E): %s\n",
+                     args_info->energy_params_arg);
+   }
+
+   /* check temperature and enthalpies */
+   if (  (args_info->fold_temperature_given || args_info->enthalpy_params_given)
+       &&(args_info->scoring_arg == scoring_arg_nussinov))
+   {
+      THROW_ERROR_MSG ("Options \"--fold-temperature\" and "
+                       "\"--enthalpy-params\" only work with the \"NN\" and "
+                       "\"simpleNN\" scoring schemes.");
+      return 1;
+   }
+   if (args_info->fold_temperature_arg <= -273.15f)
+   {
+      THROW_ERROR_MSG ("Option \"--fold-temperature\" requires a temperature "
+                       "above absolute zero as argument, found: %.2f",
+                       args_info->fold_temperature_arg);
+      return 1;
+   }
+   if (args_info->fold_temperature_given)
+   {
+      print_verbose ("# Fold temperature        (-F): %.2f\n",
+                     args_info->fold_temperature_arg);
+   }
+   if (args_info->enthalpy_params_given)
+   {
+      print_verbose ("# Enthalpies              (-Y): %s\n",
+                     args_info->enthalpy_params_arg);
+   }
+
+   /* check span of unwanted pairs */
+   if (args_info->neg_span_arg < 0)
+   {
+      THROW_ERROR_MSG ("Option \"--neg-span\" requires non-negative integer "
+                       "as argument, found: %ld", args_info->neg_span_arg);
+      return 1;
+   }
+   if (args_info->neg_all_pairs_given)
+   {
+      print_verbose ("# Max. span neg. design   (-A): all\n");
+   }
+   else
+   {
+      print_verbose ("# Max. span neg. design   (-W): %ld\n",
+                     args_info->neg_span_arg);
+   }
+
+   /* check tolerance for recalculating structure elements */
+   if (args_info->dirty_tolerance_arg < 0.0f)
+   {
+      THROW_ERROR_MSG ("Option \"--dirty-tolerance\" requires non-negative "
+                       "float as argument, found: %.2f",
+                       args_info->dirty_tolerance_arg);
+      return 1;
+   }
+   print_verbose ("# Element tolerance       (-R): %.4f\n",
+                  args_info->dirty_tolerance_arg);
+
+   /* check two-stage annealing */
+   if (  args_info->helix_first_given
+       &&(args_info->scoring_arg == scoring_arg_simpleNN))
+   {
+      THROW_ERROR_MSG ("Option \"--helix-first\" only works with the \"NN\" "
+                       "and \"nussinov\" scoring schemes.");
+      return 1;
+   }
+
    return 0;
 }
 
@@ -236,94 +462,83 @@ adopt_site_presettings (const struct brot_args_info* args_info,
    return 0;
 }
 
+/* Anneal a sequence matrix. With --helix-first, only paired sites are
+   annealed in a first stage, unpaired sites are frozen at their current
+   distribution. Then all sites are released for a second, shorter stage
+   starting cooler. */
 static int
-simulate_using_simplenn_scoring (struct brot_args_info* brot_args,
-                                 SeqMatrix* sm,
-                                 Scmf_Rna_Opt_data* data,
-                                 GFile* entropy_file,
-                                 GFile* simulation_file)
+anneal (const struct brot_args_info* brot_args,
+        GFile* entropy_file,
+        GFile* simulation_file,
+        SeqMatrix* sm,
+        Scmf_Rna_Opt_data* data)
 {
    int error = 0;
-   char** bp_allowed = NULL;
-   char bi, bj;
-   unsigned long i, j, k;
-   unsigned long alpha_size
-      = alphabet_size (scmf_rna_opt_data_get_alphabet(data));
-   unsigned long allowed_bp = 0;
-   NN_scores* scores =
-      NN_SCORES_NEW_INIT(0, scmf_rna_opt_data_get_alphabet (data));
-
-   if (scores == NULL)
-   {
-      error = 1;
-   }
-
-   /* prepare index of allowed base pairs */
-   if (!error)
-   {
-      bp_allowed = XMALLOC(alpha_size * sizeof (*bp_allowed));
-      if (bp_allowed == NULL)
-      {
-         error = 1;
-      }
-   }
-
-   if (!error)
+   unsigned long i;
+   unsigned long n_frozen = 0;
+   unsigned long n_open = 0;
+   unsigned long* frozen = NULL;
+   unsigned long width = seqmatrix_get_width (sm);
+   unsigned long steps = (unsigned long) brot_args->steps_arg;
+   float temp = brot_args->temp_arg;
+   Rna* rna;
+
+   if (brot_args->helix_first_given)
    {
-
-      allowed_bp = nn_scores_no_allowed_basepairs (scores);
-
-      /* we need 1 byte for each possible pair + 1byte for the NULL byte for
-         each letter in the alphabet */
-      bp_allowed[0] = XCALLOC (allowed_bp + alpha_size,
-                               sizeof (**(bp_allowed)));
-      if (bp_allowed[0] == NULL)
+      frozen = XMALLOC (width * sizeof (*frozen));
+      if (frozen == NULL)
       {
-         error = 1;
+         return 1;
       }
-   }
 
-   if (!error)
-   {
-      i = 0;
-      k = 0;
-      while (i < alpha_size)
+      rna = scmf_rna_opt_data_get_rna (data);
+      for (i = 0; i < width; i++)
       {
-         bp_allowed[i] = bp_allowed[0] + (k * sizeof (**(bp_allowed)));
-         
-         for (j = 0; j < allowed_bp; j++)
+         if (!seqmatrix_is_col_fixed (i, sm))
          {
-            nn_scores_get_allowed_basepair (j, &bi, &bj, scores);
-            if (i == (unsigned) bi)
+            if (rna_base_pairs_with (i, rna) == NOT_PAIRED)
             {
-               bp_allowed[0][k] = (char)(bj + 1);
-               k++;
+               seqmatrix_freeze_col (i, sm);
+               frozen[n_frozen] = i;
+               n_frozen++;
+            }
+            else
+            {
+               n_open++;
             }
          }
-         
-         k++;
-         i++;
       }
+
+      /* stage 1: stems only */
+      if ((n_frozen > 0) && (n_open > 0))
+      {
+         error = seqmatrix_simulate_scmf (steps,
+                                          temp,
+                                          brot_args->beta_long_arg,
+                                          brot_args->beta_short_arg,
+                                          brot_args->speedup_threshold_arg,
+                                          brot_args->min_cool_arg,
+                                          brot_args->lambda_arg,
+                                          brot_args->sm_entropy_arg,
+                                          entropy_file,
+                                          simulation_file,
+                                          sm,
+                                          data);
+         temp *= HELIX_LOOP_TEMP;
+         steps = (unsigned long) (steps * HELIX_LOOP_STEPS);
+      }
+
+      for (i = 0; i < n_frozen; i++)
+      {
+         seqmatrix_unfreeze_col (frozen[i], sm);
+      }
+      XFREE (frozen);
    }
 
-   /* simulate */
    if (!error)
    {
-      scmf_rna_opt_data_set_scores (scores, data);
-      scmf_rna_opt_data_set_bp_allowed (bp_allowed, data);
-
-      seqmatrix_set_gas_constant (GAS_CONST, sm);
-
-      seqmatrix_set_func_calc_cell_energy (scmf_rna_opt_calc_simplenn, sm);
-      /*scmf_rna_opt_data_init_negative_design_energies (data, sm);*/
-      seqmatrix_set_pre_col_iter_hook (
-        scmf_rna_opt_data_init_negative_design_energies_alt, sm);
-
-      seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB: 27.11.09 moved here */
-      seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
-
-      error = seqmatrix_simulate_scmf (brot_args->steps_arg,
-                                       brot_args->temp_arg,
+      error = seqmatrix_simulate_scmf (steps,
+                                       temp,
                                        brot_args->beta_long_arg,
                                        brot_args->beta_short_arg,
                                        brot_args->speedup_threshold_arg,
@@ -337,63 +552,199 @@ simulate_using_simplenn_scoring (struct brot_args_info* brot_args,
                                        data);
    }
 
-   /* collate */
-   if (!error)
+   return error;
+}
+
+/* Bias all sites not fixed towards the seed sequence. */
+static int
+adopt_seed_sequence (const struct brot_args_info* args_info,
+                     Alphabet* sigma,
+                     SeqMatrix* sm)
+{
+   unsigned long i;
+   unsigned long struct_len;
+   char base;
+
+   assert (sm);
+
+   struct_len = seqmatrix_get_width (sm);
+
+   if (strlen (args_info->seed_sequence_arg) != struct_len)
    {
- /* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 - moved before simulation starts */
-      seqmatrix_set_fixed_site_hook (scmf_rna_opt_data_update_neg_design_energy,
-                                     sm);
+      THROW_ERROR_MSG ("Seed sequence of length %lu does not fit structure "
+                       "of length %lu",
+                       (unsigned long) strlen (args_info->seed_sequence_arg),
+                       struct_len);
+      return 1;
+   }
 
-      error = seqmatrix_collate_is (COLLATE_THRESH,
-                                    brot_args->steps_arg / 2,
-                                    brot_args->temp_arg, 
-                                    brot_args->beta_long_arg,
-                                    brot_args->beta_short_arg,
-                                    brot_args->speedup_threshold_arg,
-                                    brot_args->min_cool_arg,
-                                    brot_args->lambda_arg,
-                                    /* brot_args->sm_entropy_arg, */
-                                    sm,
-                                    data);
-      /*error = seqmatrix_collate_mv (sm, data);*/
+   for (i = 0; i < struct_len; i++)
+   {
+      base = alphabet_base_2_no (args_info->seed_sequence_arg[i], sigma);
+      if (base == CHAR_UNDEF)
+      {
+         return 1;
+      }
+
+      if (!seqmatrix_is_col_fixed (i, sm))
+      {
+         seqmatrix_preset_col ((unsigned long) base, i,
+                               args_info->seed_confidence_arg, sm);
+      }
    }
 
-   nn_scores_delete (scores);
-   scmf_rna_opt_data_set_scores (NULL, data);
-   scmf_rna_opt_data_set_bp_allowed (NULL, data);
+   return 0;
+}
+
+static void
+brot_scoring_delete (BrotScoring* this)
+{
+   if (this != NULL)
+   {
+      if (this->scoring == scoring_arg_nussinov)
+      {
+         XFREE_2D ((void**) this->scores);
+      }
+      else
+      {
+         nn_scores_delete (this->scores);
+         nn_scores_at_temperature_release (this->derived);
+      }
 
-   XFREE (bp_allowed[0]);
-   XFREE (bp_allowed);
+      if (this->bp_allowed != NULL)
+      {
+         XFREE (this->bp_allowed[0]);
+         XFREE (this->bp_allowed);
+      }
 
-   return error;
+      XFREE (this);
+   }
 }
 
-static int
-simulate_using_nn_scoring (struct brot_args_info* brot_args,
-                           SeqMatrix* sm,
-                           Scmf_Rna_Opt_data* data,
-                           GFile* entropy_file,
-                           GFile* simulation_file)
+static void
+brot_params_delete (BrotParams* this)
 {
-   int error = 0;
-   char** bp_allowed = NULL;
+   if (this != NULL)
+   {
+      nn_scores_delete (this->free_energy);
+      nn_scores_delete (this->enthalpy);
+      XFREE (this);
+   }
+}
+
+/* Read the energy parameters of the (simple) NN model, from files if
+   given. Returns NULL on error. */
+static BrotParams*
+brot_params_new (const struct brot_args_info* brot_args, Alphabet* sigma)
+{
+   BrotParams* this;
+
+   this = XMALLOC (sizeof (*this));
+   if (this == NULL)
+   {
+      return NULL;
+   }
+   this->free_energy = NULL;
+   this->enthalpy = NULL;
+
+   if (brot_args->energy_params_given)
+   {
+      this->free_energy = NN_SCORES_NEW_FROM_FILE (
+         brot_args->energy_params_arg, 0.0f, sigma);
+   }
+   else
+   {
+      this->free_energy = NN_SCORES_NEW_INIT(0.0f, sigma);
+   }
+
+   if ((this->free_energy != NULL) && brot_args->enthalpy_params_given)
+   {
+      this->enthalpy = NN_SCORES_NEW_FROM_FILE (brot_args->enthalpy_params_arg,
+                                                0.0f, sigma);
+      if (this->enthalpy == NULL)
+      {
+         brot_params_delete (this);
+         return NULL;
+      }
+   }
+
+   if (this->free_energy == NULL)
+   {
+      brot_params_delete (this);
+      return NULL;
+   }
+
+   return this;
+}
+
+/* Set up the scoring scheme chosen: the Nussinov scoring matrix or the
+   energy parameters of the (simple) NN model at a temperature with the index
+   of allowed base pairs. Parameters for a temperature are shared, each
+   scoring gets its own copy with thermal noise added for the NN model. With
+   at most one scoring per temperature, the copy stores its noise instead of
+   sharing the internal loop tables, which would add noise on every lookup.
+   Noise is always drawn from stream 0 of the seed, so a design does not
+   depend on the position of its temperature in a batch. Scorings of
+   different temperatures differ anyway. */
+static BrotScoring*
+brot_scoring_new (const struct brot_args_info* brot_args, Alphabet* sigma,
+                  const BrotParams* params, const float temperature)
+{
+   BrotScoring* this;
+   NN_scores* scores = NULL;
+   const NN_scores* source;
+   float offset = 0.0f;
+   bool noise = false;
    char bi, bj;
    long int seed;
    unsigned long i, j, k;
-   unsigned long alpha_size
-      = alphabet_size (scmf_rna_opt_data_get_alphabet(data));
+   unsigned long alpha_size = alphabet_size (sigma);
    unsigned long allowed_bp = 0;
-   NN_scores* scores =
+   int error = 0;
+
+   this = XMALLOC (sizeof (*this));
+   if (this == NULL)
+   {
+      return NULL;
+   }
+   this->scoring = brot_args->scoring_arg;
+   this->scores = NULL;
+   this->bp_allowed = NULL;
+   this->derived = NULL;
+   this->temperature = temperature;
+
+   if (this->scoring == scoring_arg_nussinov)
+   {
+      this->scores = create_scoring_matrix (sigma);
+      if (this->scores == NULL)
+      {
+         brot_scoring_delete (this);
+         return NULL;
+      }
+
+      return this;
+   }
+
+   if (this->scoring == scoring_arg_NN)
+   {
       /* SB: 17.11.09 50 */
-      NN_SCORES_NEW_INIT(50.0f, scmf_rna_opt_data_get_alphabet (data));
+      offset = 50.0f;
+   }
+
+   source = params->free_energy;
+   if (temperature != nn_scores_get_temperature (source))
+   {
+      this->derived = nn_scores_at_temperature (source, params->enthalpy,
+                                                temperature);
+      source = this->derived;
+   }
 
-   if (scores == NULL)
+   if (source == NULL)
    {
       error = 1;
    }
 
-   /* prepare index of allowed base pairs */
-   if (!error)
+   if ((!error) && (this->scoring == scoring_arg_NN))
    {
       /* "randomise" scoring function */
       print_verbose ("# Random seed             (-r): ");
@@ -402,9 +753,9 @@ simulate_using_nn_scoring (struct brot_args_info* brot_args,
          if (brot_args->seed_arg != 0)
          {
             print_verbose ("%ld\n", brot_args->seed_arg);
-            nn_scores_add_thermal_noise (alpha_size,
-                                         brot_args->seed_arg,
-                                         scores);
+            rng_init ((unsigned long) brot_args->seed_arg, 0,
+                      &(this->rng));
+            noise = true;
          }
          else
          {
@@ -416,13 +767,31 @@ simulate_using_nn_scoring (struct brot_args_info* brot_args,
          /* if no seed is given, use time */
          seed = (long int) time(NULL);
          print_verbose ("%ld\n", seed);
-         nn_scores_add_thermal_noise (alpha_size,
-                                      seed,
-                                      scores);
+         rng_init ((unsigned long) seed, 0, &(this->rng));
+         noise = true;
+      }
+   }
+
+   if (!error)
+   {
+      scores = NN_SCORES_NEW_COPY (source, offset);
+      this->scores = scores;
+
+      if (scores == NULL)
+      {
+         error = 1;
       }
+      else if (noise)
+      {
+         nn_scores_add_thermal_noise (alpha_size, &(this->rng), scores);
+      }
+   }
 
-      bp_allowed = XMALLOC(alpha_size * sizeof (*bp_allowed));
-      if (bp_allowed == NULL)
+   /* prepare index of allowed base pairs */
+   if (!error)
+   {
+      this->bp_allowed = XMALLOC(alpha_size * sizeof (*(this->bp_allowed)));
+      if (this->bp_allowed == NULL)
       {
          error = 1;
       }
@@ -434,10 +803,12 @@ simulate_using_nn_scoring (struct brot_args_info* brot_args,
 
       /* we need 1 byte for each possible pair + 1byte for the NULL byte for
          each letter in the alphabet */
-      bp_allowed[0] = XCALLOC (allowed_bp + alpha_size,
-                               sizeof (**(bp_allowed)));
-      if (bp_allowed[0] == NULL)
+      this->bp_allowed[0] = XCALLOC (allowed_bp + alpha_size,
+                                     sizeof (**(this->bp_allowed)));
+      if (this->bp_allowed[0] == NULL)
       {
+         XFREE (this->bp_allowed);
+         this->bp_allowed = NULL;
          error = 1;
       }
    }
@@ -448,14 +819,15 @@ simulate_using_nn_scoring (struct brot_args_info* brot_args,
       k = 0;
       while (i < alpha_size)
       {
-         bp_allowed[i] = bp_allowed[0] + (k * sizeof (**(bp_allowed)));
+         this->bp_allowed[i] = this->bp_allowed[0]
+            + (k * sizeof (**(this->bp_allowed)));
          
          for (j = 0; j < allowed_bp; j++)
          {
             nn_scores_get_allowed_basepair (j, &bi, &bj, scores);
             if (i == (unsigned) bi)
             {
-               bp_allowed[0][k] = (char)(bj + 1);
+               this->bp_allowed[0][k] = (char)(bj + 1);
                k++;
             }
          }
@@ -465,140 +837,1748 @@ simulate_using_nn_scoring (struct brot_args_info* brot_args,
       }
    }
 
-   /* decompose secondary structure */
-   if (!error)
+   if (error)
    {
-      error = scmf_rna_opt_data_secstruct_init (data);
+      brot_scoring_delete (this);
+      return NULL;
    }
 
-   /*mfprintf (stdout, "TREATMENT of fixed sites: If both sites of a pair are "
-     "fixed, delete from list? Verbose info!!!\n");*/
+   return this;
+}
 
-   /* set our special function for calc. cols.: Iterate over sec.struct., not
-      sequence matrix! */
-   if (!error)
-   {
-      scmf_rna_opt_data_set_scores (scores, data);
-      scmf_rna_opt_data_set_bp_allowed (bp_allowed, data);
-      scmf_rna_opt_data_set_scales (brot_args->negative_design_scaling_arg,
-                                    brot_args->heterogenity_term_scaling_arg,
-                                    data);
-      scmf_rna_opt_data_set_het_window (brot_args->window_size_arg, data);
+static int
+simulate_using_simplenn_scoring (struct brot_args_info* brot_args,
+                                 BrotScoring* scoring,
+                                 SeqMatrix* sm,
+                                 Scmf_Rna_Opt_data* data,
+                                 GFile* entropy_file,
+                                 GFile* simulation_file,
+                                 const bool collate_mv)
+{
+   int error = 0;
 
-      seqmatrix_set_func_calc_eeff_col (scmf_rna_opt_calc_col_nn, sm);
-      seqmatrix_set_gas_constant (8.314472, sm);
+   /* simulate */
+   scmf_rna_opt_data_set_scores (scoring->scores, data);
+   scmf_rna_opt_data_set_bp_allowed (scoring->bp_allowed, data);
+
+   seqmatrix_set_gas_constant (GAS_CONST, sm);
+
+   seqmatrix_set_func_calc_cell_energy (scmf_rna_opt_calc_simplenn, sm);
+   /*scmf_rna_opt_data_init_negative_design_energies (data, sm);*/
+   seqmatrix_set_pre_col_iter_hook (
+     scmf_rna_opt_data_init_negative_design_energies_alt, sm);
+
+   seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB: 27.11.09 moved here */
+   seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
+
+   error = anneal (brot_args, entropy_file, simulation_file, sm, data);
+
+   /* collate */
+   if ((!error) && collate_mv)
+   {
+      error = seqmatrix_collate_mv (sm, data);
+   }
+   else if (!error)
+   {
+ /* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 - moved before simulation starts */
+      error = seqmatrix_collate_is (COLLATE_THRESH,
+                                    brot_args->steps_arg / 2,
+                                    brot_args->temp_arg, 
+                                    brot_args->beta_long_arg,
+                                    brot_args->beta_short_arg,
+                                    brot_args->speedup_threshold_arg,
+                                    brot_args->min_cool_arg,
+                                    brot_args->lambda_arg,
+                                    /* brot_args->sm_entropy_arg, */
+                                    sm,
+                                    data);
+      /*error = seqmatrix_collate_mv (sm, data);*/
+   }
+
+   scmf_rna_opt_data_set_scores (NULL, data);
+   scmf_rna_opt_data_set_bp_allowed (NULL, data);
+
+   return error;
+}
+
+static int
+simulate_using_nn_scoring (struct brot_args_info* brot_args,
+                           BrotScoring* scoring,
+                           SeqMatrix* sm,
+                           Scmf_Rna_Opt_data* data,
+                           GFile* entropy_file,
+                           GFile* simulation_file,
+                           const bool collate_mv)
+{
+   int error = 0;
+
+   /* decompose secondary structure */
+   error = scmf_rna_opt_data_secstruct_init (data);
+
+   /*mfprintf (stdout, "TREATMENT of fixed sites: If both sites of a pair are "
+     "fixed, delete from list? Verbose info!!!\n");*/
+
+   /* set our special function for calc. cols.: Iterate over sec.struct., not
+      sequence matrix! */
+   if (!error)
+   {
+      scmf_rna_opt_data_set_scores (scoring->scores, data);
+      scmf_rna_opt_data_set_bp_allowed (scoring->bp_allowed, data);
+      scmf_rna_opt_data_set_scales (brot_args->negative_design_scaling_arg,
+                                    brot_args->heterogenity_term_scaling_arg,
+                                    data);
+      scmf_rna_opt_data_set_het_window (brot_args->window_size_arg, data);
+      if (brot_args->neg_all_pairs_given)
+      {
+         scmf_rna_opt_data_set_neg_span (SCMF_RNA_OPT_NEG_SPAN_ALL, data);
+      }
+      else
+      {
+         scmf_rna_opt_data_set_neg_span (
+            (unsigned long) brot_args->neg_span_arg, data);
+      }
+      scmf_rna_opt_data_set_dirty_tolerance (brot_args->dirty_tolerance_arg,
+                                             data);
+      error = scmf_rna_opt_data_set_threads (
+         (unsigned long) brot_args->threads_arg, data);
+   }
+
+   if (!error)
+   {
+      seqmatrix_set_func_calc_eeff_col (scmf_rna_opt_calc_col_nn, sm);
+      seqmatrix_set_gas_constant (8.314472, sm);
+
+      seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB 27.11.09 moved here */
+      seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
+
+      error = anneal (brot_args, entropy_file, simulation_file, sm, data);
+   }
+
+   /* collate */
+   if ((!error) && collate_mv)
+   {
+      error = seqmatrix_collate_mv (sm, data);
+   }
+   else if (!error)
+   {
+      /*seqmatrix_print_2_stdout (2, sm);*/
+/* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 moved before simulation*/
+
+      error = seqmatrix_collate_is (COLLATE_THRESH,
+                                    brot_args->steps_arg / 2,
+                                    brot_args->temp_arg,
+                                    brot_args->beta_long_arg,
+                                    brot_args->beta_short_arg,
+                                    brot_args->speedup_threshold_arg,
+                                    brot_args->min_cool_arg,
+                                    brot_args->lambda_arg,
+                                    /* brot_args->sm_entropy_arg, */
+                                    sm,
+                                    data);
+      /*error = seqmatrix_collate_mv (sm, data);*/
+   }
+
+   /* first: iterate scmf on secstruct, not sm! */
+
+   scmf_rna_opt_data_set_scores (NULL, data);
+   scmf_rna_opt_data_set_bp_allowed (NULL, data);
+
+   return error;
+}
+
+static int
+simulate_using_nussinov_scoring (const struct brot_args_info* brot_args,
+                                 BrotScoring* scoring,
+                                 SeqMatrix* sm, Scmf_Rna_Opt_data* data,
+                                 GFile* entropy_file,
+                                 GFile* simulation_file,
+                                 const bool collate_mv)
+{
+   int error = 0;
+
+   /* simulate */
+   scmf_rna_opt_data_set_scores (scoring->scores, data);
+
+   /* seqmatrix_set_func_calc_eeff_row (seqmatrix_calc_eeff_row_scmf, sm);*/
+   seqmatrix_set_func_calc_cell_energy (scmf_rna_opt_calc_nussinov, sm);
+   seqmatrix_set_pre_col_iter_hook (
+     scmf_rna_opt_data_init_nussinov_aggregates, sm);
+
+   seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB 27.11.09 moved here */
+   seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
+
+   error = anneal (brot_args, entropy_file, simulation_file, sm, data);
+
+   if ((!error) && collate_mv)
+   {
+      error = seqmatrix_collate_mv (sm, data);
+   }
+   else if (!error)
+   {
+/* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 moved before simulation starts */
+
+      error = seqmatrix_collate_is (COLLATE_THRESH,
+                                    brot_args->steps_arg / 2,
+                                    brot_args->temp_arg,
+                                    brot_args->beta_long_arg,
+                                    brot_args->beta_short_arg,
+                                    brot_args->speedup_threshold_arg,
+                                    brot_args->min_cool_arg,
+                                    brot_args->lambda_arg,
+                                    /* brot_args->sm_entropy_arg, */
+                                    sm,
+                                    data);
+      /* error = seqmatrix_collate_mv (sm, sigma); */
+   }
+
+   scmf_rna_opt_data_set_scores (NULL, data);
+
+   return error;
+}
+
+/* Run a simulation with the chosen scoring scheme. Collating is done by
+   iterative simulations or, with collate_mv, by just taking the most
+   probable base of each site. */
+static int
+simulate (struct brot_args_info* brot_args,
+          BrotScoring* scoring,
+          SeqMatrix* sm,
+          Scmf_Rna_Opt_data* data,
+          GFile* entropy_file,
+          GFile* simulation_file,
+          const bool collate_mv)
+{
+   if (brot_args->scoring_arg == scoring_arg_simpleNN)
+   {
+      return simulate_using_simplenn_scoring (brot_args, scoring, sm, data,
+                                              entropy_file, simulation_file,
+                                              collate_mv);
+   }
+   else if (brot_args->scoring_arg == scoring_arg_nussinov)
+   {
+      return simulate_using_nussinov_scoring (brot_args, scoring, sm, data,
+                                              entropy_file, simulation_file,
+                                              collate_mv);
+   }
+
+   return simulate_using_nn_scoring (brot_args, scoring, sm, data,
+                                     entropy_file, simulation_file,
+                                     collate_mv);
+}
+
+/* Split a structure into the parts closed by the stems of the external
+   loop. Unpaired bases of the external loop do not belong to any domain.
+   Returns the no. of domains, which may be 0 for unstructured RNA. */
+static unsigned long
+find_domains (BrotDomain* list, const Rna* rna)
+{
+   unsigned long i, j;
+   unsigned long n = 0;
+   unsigned long size = rna_get_size (rna);
+
+   i = 0;
+   while (i < size)
+   {
+      j = rna_base_pairs_with (i, rna);
+      if ((j != NOT_PAIRED) && (j > i))
+      {
+         list[n].start = i;
+         list[n].size  = j - i + 1;
+         list[n].data  = NULL;
+         list[n].sm    = NULL;
+         list[n].error = 0;
+         n++;
+         i = j;
+      }
+      i++;
+   }
+
+   return n;
+}
+
+/* Design a single domain in its own sequence matrix. Fixed sites of the
+   whole structure are adopted. */
+static int
+design_domain (BrotDomain* dom,
+               struct brot_args_info* brot_args,
+               BrotScoring* scoring,
+               const Rna* rna,
+               const SeqMatrix* sm)
+{
+   int error = 0;
+   unsigned long i, j, row;
+   char* structure;
+
+   structure = XMALLOC ((dom->size + 1) * sizeof (*structure));
+   if (structure == NULL)
+   {
+      return 1;
+   }
+
+   for (i = 0; i < dom->size; i++)
+   {
+      j = rna_base_pairs_with (dom->start + i, rna);
+      if (j == NOT_PAIRED)
+      {
+         structure[i] = '.';
+      }
+      else if (j > (dom->start + i))
+      {
+         structure[i] = '(';
+      }
+      else
+      {
+         structure[i] = ')';
+      }
+   }
+   structure[dom->size] = '\0';
+
+   dom->data = SCMF_RNA_OPT_DATA_NEW_INIT(structure,
+                                          dom->size,
+                                          RNA_ALPHABET,
+                                          strlen(RNA_ALPHABET)/2,
+                         ((-1) * ((logf (1 / 0.000001f)) / (dom->size))),
+                                          0);
+   XFREE (structure);
+   if (dom->data == NULL)
+   {
+      return 1;
+   }
+
+   dom->sm = SEQMATRIX_NEW;
+   if (dom->sm == NULL)
+   {
+      return 1;
+   }
+   error = SEQMATRIX_INIT (
+      alphabet_size (scmf_rna_opt_data_get_alphabet (dom->data)),
+      dom->size,
+      dom->sm);
+
+   for (i = 0; (!error) && (i < dom->size); i++)
+   {
+      if (seqmatrix_is_col_fixed (dom->start + i, sm))
+      {
+         for (row = 0; row < seqmatrix_get_rows (sm); row++)
+         {
+            if (seqmatrix_get_probability (row, dom->start + i, sm) > 0.5f)
+            {
+               error = seqmatrix_fix_col (row, i, dom->data, dom->sm);
+               break;
+            }
+         }
+      }
+   }
+
+   /* seeds of the domain */
+   for (i = 0; (!error) && brot_args->seed_sequence_given && (i < dom->size);
+        i++)
+   {
+      if (!seqmatrix_is_col_fixed (i, dom->sm))
+      {
+         seqmatrix_preset_col ((unsigned long) alphabet_base_2_no (
+                                  brot_args->seed_sequence_arg[dom->start + i],
+                                  scmf_rna_opt_data_get_alphabet (dom->data)),
+                               i, brot_args->seed_confidence_arg, dom->sm);
+      }
+   }
+
+   if (!error)
+   {
+      error = simulate (brot_args, scoring, dom->sm, dom->data, NULL, NULL,
+                        brot_args->seed_sequence_given);
+   }
+
+   return error;
+}
+
+#ifdef HAVE_PTHREAD
+/* Thread designing domains: fetch domains from the queue until it is
+   empty. */
+static void*
+domain_worker (void* arg)
+{
+   BrotDomainQueue* queue = (BrotDomainQueue*) arg;
+   unsigned long d;
+
+   for (;;)
+   {
+      pthread_mutex_lock (&(queue->lock));
+      d = queue->next;
+      if (d < queue->n)
+      {
+         queue->next++;
+      }
+      pthread_mutex_unlock (&(queue->lock));
+
+      if (d >= queue->n)
+      {
+         break;
+      }
+
+      queue->list[d].error = design_domain (&(queue->list[d]),
+                                            queue->brot_args,
+                                            queue->scoring,
+                                            queue->rna,
+                                            queue->sm);
+   }
+
+   return NULL;
+}
+
+static int
+cmp_domain_size (const void* a, const void* b)
+{
+   const BrotDomain* da = (const BrotDomain*) a;
+   const BrotDomain* db = (const BrotDomain*) b;
+
+   if (da->size != db->size)
+   {
+      return (da->size > db->size) ? -1 : 1;
+   }
+
+   return (da->start < db->start) ? -1 : (da->start > db->start);
+}
+#endif
+
+/* Design the domains of a structure separately, put them together as start
+   of a short simulation of the whole matrix. Most of the time of a design
+   goes into collating, which re-simulates the matrix for each ambiguous
+   site. For domains, this is much cheaper than for the whole structure. */
+static int
+design_decomposed (struct brot_args_info* brot_args,
+                   BrotScoring* scoring,
+                   SeqMatrix* sm,
+                   Scmf_Rna_Opt_data* data,
+                   GFile* entropy_file,
+                   GFile* simulation_file)
+{
+   int error = 0;
+   unsigned long d, i;
+   unsigned long n_dom;
+   struct brot_args_info dom_args;
+   struct brot_args_info refine_args;
+   BrotDomain* domains;
+   const char* seq;
+   Rna* rna = scmf_rna_opt_data_get_rna (data);
+#ifdef HAVE_PTHREAD
+   BrotDomainQueue queue;
+   pthread_t* threads = NULL;
+   bool* started = NULL;
+   unsigned long t;
+#endif
+
+   domains = XMALLOC ((rna_get_size (rna) / 2 + 1) * sizeof (*domains));
+   if (domains == NULL)
+   {
+      return 1;
+   }
+   n_dom = find_domains (domains, rna);
+
+   print_verbose ("# Domains                 (-D): %lu\n", n_dom);
+
+   /* a single domain covering the whole structure: nothing to split */
+   if ((n_dom == 0)
+       || ((n_dom == 1) && (domains[0].size == rna_get_size (rna))))
+   {
+      XFREE (domains);
+      return simulate (brot_args, scoring, sm, data, entropy_file,
+                       simulation_file, brot_args->seed_sequence_given);
+   }
+
+   /* threads are spent on domains, not inside */
+   dom_args = *brot_args;
+   dom_args.threads_arg = 1;
+
+#ifdef HAVE_PTHREAD
+   qsort (domains, n_dom, sizeof (*domains), cmp_domain_size);
+
+   queue.list = domains;
+   queue.n = n_dom;
+   queue.next = 0;
+   queue.brot_args = &dom_args;
+   queue.scoring = scoring;
+   queue.rna = rna;
+   queue.sm = sm;
+   pthread_mutex_init (&(queue.lock), NULL);
+
+   if (brot_args->threads_arg > 1)
+   {
+      threads = XMALLOC ((unsigned long) (brot_args->threads_arg - 1)
+                         * sizeof (*threads));
+      started = XCALLOC ((unsigned long) (brot_args->threads_arg - 1),
+                         sizeof (*started));
+      if ((threads == NULL) || (started == NULL))
+      {
+         error = 1;
+      }
+   }
+
+   if (!error)
+   {
+      /* if threads can not be started, the remaining ones pick up their
+         work */
+      for (t = 0; t < (unsigned long) (brot_args->threads_arg - 1); t++)
+      {
+         started[t] = (pthread_create (&(threads[t]), NULL,
+                                       domain_worker, &queue) == 0);
+      }
+      domain_worker (&queue);
+
+      for (t = 0; t < (unsigned long) (brot_args->threads_arg - 1); t++)
+      {
+         if (started[t])
+         {
+            pthread_join (threads[t], NULL);
+         }
+      }
+   }
+
+   pthread_mutex_destroy (&(queue.lock));
+   XFREE (threads);
+   XFREE (started);
+#else
+   for (d = 0; d < n_dom; d++)
+   {
+      domains[d].error = design_domain (&(domains[d]), &dom_args, scoring,
+                                        rna, sm);
+   }
+#endif
+
+   /* stitch domains into the whole matrix */
+   for (d = 0; (!error) && (d < n_dom); d++)
+   {
+      error = domains[d].error;
+      if (!error)
+      {
+         seq = scmf_rna_opt_data_get_seq (domains[d].data);
+         for (i = 0; i < domains[d].size; i++)
+         {
+            if (!seqmatrix_is_col_fixed (domains[d].start + i, sm))
+            {
+               seqmatrix_preset_col ((unsigned long) alphabet_base_2_no (
+                                        seq[i],
+                                        scmf_rna_opt_data_get_alphabet (data)),
+                                     domains[d].start + i,
+                                     DOMAIN_PRESET_PROB,
+                                     sm);
+            }
+         }
+      }
+   }
+
+   for (d = 0; d < n_dom; d++)
+   {
+      seqmatrix_delete (domains[d].sm);
+      scmf_rna_opt_data_delete (domains[d].data);
+   }
+   XFREE (domains);
+
+   /* refine the whole structure, starting cool. Since the domains are
+      already collated, the most probable bases are taken afterwards. */
+   if (!error)
+   {
+      refine_args = *brot_args;
+      refine_args.temp_arg = brot_args->temp_arg * DOMAIN_REFINE_TEMP;
+      error = simulate (&refine_args, scoring, sm, data, entropy_file,
+                        simulation_file, true);
+   }
+
+   return error;
+}
+
+/* Design a sequence for the whole structure. Runs seeded by a sequence are
+   collated by majority vote, since the seed is already a collated
+   sequence. */
+static int
+design (struct brot_args_info* brot_args,
+        BrotScoring* scoring,
+        SeqMatrix* sm,
+        Scmf_Rna_Opt_data* data,
+        GFile* entropy_file,
+        GFile* simulation_file)
+{
+   if (brot_args->decompose_given)
+   {
+      return design_decomposed (brot_args, scoring, sm, data, entropy_file,
+                                simulation_file);
+   }
+
+   return simulate (brot_args, scoring, sm, data, entropy_file,
+                    simulation_file, brot_args->seed_sequence_given);
+}
+
+/* Append a named float parameter to a cache key. The value goes in as its
+   bit pattern, so keys are exact and do not depend on float formatting. */
+static int
+brot_cache_key_float (Str* key, const char* name, const float value)
+{
+   uint32_t bits;
+   char buf[32];
+   int error = 0;
+
+   memcpy (&bits, &value, sizeof (bits));
+   msnprintf (buf, sizeof (buf), " %08lx\n", (unsigned long) bits);
+
+   error |= str_append_cstr (key, name);
+   error |= str_append_cstr (key, buf);
+
+   return error;
+}
+
+/* Append a named file to a cache key. Files are told apart by path, size
+   and time of change. Returns 1 if the file can not be accessed. */
+static int
+brot_cache_key_file (Str* key, const char* name, const char* path)
+{
+   struct stat st;
+   char buf[64];
+   int error = 0;
+
+   if (stat (path, &st) != 0)
+   {
+      return 1;
+   }
+
+   error |= str_append_cstr (key, name);
+   error |= str_append_cstr (key, " ");
+   error |= str_append_cstr (key, path);
+   msnprintf (buf, sizeof (buf), " %ld %ld\n", (long) st.st_size,
+              (long) st.st_mtime);
+   error |= str_append_cstr (key, buf);
+
+   return error;
+}
+
+/* Cache key of a design: all parameters with influence on the design
+   in a fixed order, one per line. Threads and output files are left out,
+   they do not change the design. Returns NULL if the design may not be
+   cached. */
+static Str*
+brot_cache_key (const struct brot_args_info* brot_args,
+                const float temperature,
+                Scmf_Rna_Opt_data* data)
+{
+   Str* key;
+   Rna* rna = scmf_rna_opt_data_get_rna (data);
+   unsigned long i, j;
+   int error = 0;
+   char buf[128];
+   char* structure;
+
+   /* designs of runs without fixed seed or with output of the trajectory
+      are not to be taken from a cache */
+   if (  ((brot_args->scoring_arg == scoring_arg_NN)
+          && (!brot_args->seed_given))
+       ||brot_args->entropy_output_given
+       ||brot_args->simulation_output_given)
+   {
+      return NULL;
+   }
+
+   key = STR_NEW_CSTR ("format " CACHE_FORMAT " " PACKAGE_STRING "\n");
+   if (key == NULL)
+   {
+      return NULL;
+   }
+
+   /* structure from the pair list, so files and strings give the same key */
+   structure = XMALLOC ((rna_get_size (rna) + 2) * sizeof (*structure));
+   if (structure == NULL)
+   {
+      str_delete (key);
+      return NULL;
+   }
+   for (i = 0; i < rna_get_size (rna); i++)
+   {
+      j = rna_base_pairs_with (i, rna);
+      if (j == NOT_PAIRED)
+      {
+         structure[i] = '.';
+      }
+      else
+      {
+         structure[i] = (j > i) ? '(' : ')';
+      }
+   }
+   structure[i] = '\n';
+   structure[i + 1] = '\0';
+   error |= str_append_cstr (key, "structure ");
+   error |= str_append_cstr (key, structure);
+   XFREE (structure);
+
+   msnprintf (buf, sizeof (buf), "scoring %d\nsteps %ld\nseed %ld\n",
+              (int) brot_args->scoring_arg, brot_args->steps_arg,
+              brot_args->seed_given ? brot_args->seed_arg : 0);
+   error |= str_append_cstr (key, buf);
+   error |= brot_cache_key_float (key, "temp", brot_args->temp_arg);
+   error |= brot_cache_key_float (key, "negative-design-scaling",
+                                  brot_args->negative_design_scaling_arg);
+   error |= brot_cache_key_float (key, "heterogenity-term-scaling",
+                                  brot_args->heterogenity_term_scaling_arg);
+   error |= brot_cache_key_float (key, "sm-entropy",
+                                  brot_args->sm_entropy_arg);
+   error |= brot_cache_key_float (key, "lambda", brot_args->lambda_arg);
+   error |= brot_cache_key_float (key, "beta-long", brot_args->beta_long_arg);
+   error |= brot_cache_key_float (key, "beta-short",
+                                  brot_args->beta_short_arg);
+   error |= brot_cache_key_float (key, "speedup-threshold",
+                                  brot_args->speedup_threshold_arg);
+   error |= brot_cache_key_float (key, "min-cool", brot_args->min_cool_arg);
+   error |= brot_cache_key_float (key, "dirty-tolerance",
+                                  brot_args->dirty_tolerance_arg);
+   msnprintf (buf, sizeof (buf), "window %ld\nneg %ld %u\nschedule %u %u\n",
+              brot_args->window_size_arg,
+              brot_args->neg_span_arg, brot_args->neg_all_pairs_given,
+              brot_args->decompose_given, brot_args->helix_first_given);
+   error |= str_append_cstr (key, buf);
+   for (i = 0; i < brot_args->fixed_nuc_given; i++)
+   {
+      error |= str_append_cstr (key, "fixed ");
+      error |= str_append_cstr (key, brot_args->fixed_nuc_arg[i]);
+      error |= str_append_cstr (key, "\n");
+   }
+   if (brot_args->energy_params_given)
+   {
+      error |= brot_cache_key_file (key, "params",
+                                    brot_args->energy_params_arg);
+   }
+   /* keys of designs at 37 degree stay as they were before temperatures */
+   if (  (brot_args->scoring_arg != scoring_arg_nussinov)
+       &&(temperature != 37.0f))
+   {
+      error |= brot_cache_key_float (key, "fold-temperature", temperature);
+      if (brot_args->enthalpy_params_given)
+      {
+         error |= brot_cache_key_file (key, "enthalpies",
+                                       brot_args->enthalpy_params_arg);
+      }
+   }
+   if (brot_args->seed_sequence_given)
+   {
+      error |= brot_cache_key_float (key, "seed-confidence",
+                                     brot_args->seed_confidence_arg);
+      error |= brot_cache_key_float (key, "seed-temp",
+                                     brot_args->seed_temp_arg);
+      error |= str_append_cstr (key, "seeded ");
+      error |= str_append_cstr (key, brot_args->seed_sequence_arg);
+      error |= str_append_cstr (key, "\n");
+   }
+
+   if (error)
+   {
+      str_delete (key);
+      return NULL;
+   }
+
+   return key;
+}
+
+/* Path of a cache entry: 64bit FNV-1a hash of the key in a directory.
+   With a suffix, the path of a temporary file for writing the entry. */
+static Str*
+brot_cache_path (const char* dir, const Str* key, const char* suffix)
+{
+   Str* path;
+   uint64_t hash = UINT64_C(14695981039346656037);
+   unsigned long i;
+   char buf[64];
+
+   for (i = 0; i < str_length (key); i++)
+   {
+      hash ^= (uint64_t) (unsigned char) str_get_i (key, i);
+      hash *= UINT64_C(1099511628211);
+   }
+
+   path = STR_NEW_CSTR (dir);
+   if (path == NULL)
+   {
+      return NULL;
+   }
+
+   if (suffix != NULL)
+   {
+      msnprintf (buf, sizeof (buf), "/." CACHE_PREFIX "%08lx%08lx.%ld.%s",
+                 (unsigned long) (hash >> 32),
+                 (unsigned long) (hash & UINT32_C(0xffffffff)),
+                 (long) getpid(), suffix);
+   }
+   else
+   {
+      msnprintf (buf, sizeof (buf), "/" CACHE_PREFIX "%08lx%08lx",
+                 (unsigned long) (hash >> 32),
+                 (unsigned long) (hash & UINT32_C(0xffffffff)));
+   }
+
+   if (str_append_cstr (path, buf))
+   {
+      str_delete (path);
+      return NULL;
+   }
+
+   return path;
+}
+
+/* Look up a design. An entry holds its key, followed by the sequence and
+   the time spent on designing it. Entries are only accepted if their key
+   matches exactly. On hits, the entry is touched to mark it as recently
+   used. Returns the sequence or NULL on misses. */
+static char*
+brot_cache_lookup (const char* dir, const Str* key, double* design_time)
+{
+   Str* path;
+   Str* stored = NULL;
+   GFile* file = NULL;
+   struct stat st;
+   char* buf = NULL;
+   size_t size = 0;
+   char* seq = NULL;
+   int error = 0;
+
+   path = brot_cache_path (dir, key, NULL);
+   if (path == NULL)
+   {
+      return NULL;
+   }
+
+   if (stat (str_get (path), &st) == 0)
+   {
+      file = GFILE_OPEN (str_get (path), str_length (path), GFILE_VOID, "r");
+      stored = STR_NEW;
+   }
+
+   if ((file != NULL) && (stored != NULL))
+   {
+      while (gfile_getline_verbatim (&error, &buf, &size, file) > 0)
+      {
+         if (strncmp (buf, "sequence ", 9) == 0)
+         {
+            seq = XMALLOC ((strlen (buf + 9) + 1) * sizeof (*seq));
+            if (seq != NULL)
+            {
+               strcpy (seq, buf + 9);
+            }
+         }
+         else if (strncmp (buf, "time ", 5) == 0)
+         {
+            *design_time = strtod (buf + 5, NULL);
+         }
+         else if (  str_append_cstr (stored, buf)
+                  ||str_append_cstr (stored, "\n"))
+         {
+            error = 1;
+         }
+      }
+
+      if (error || (str_compare_str (stored, key) != 0))
+      {
+         XFREE (seq);
+         seq = NULL;
+      }
+   }
+
+   if (seq != NULL)
+   {
+      utime (str_get (path), NULL);
+   }
+
+   gfile_close (file);
+   str_delete (stored);
+   XFREE (buf);
+   str_delete (path);
+
+   return seq;
+}
+
+/* Remove the least recently used entries until at most max_entries are
+   left. Failures are not fatal for a cache. */
+static void
+brot_cache_evict (const char* dir, const unsigned long max_entries)
+{
+   DIR* d;
+   struct dirent* entry;
+   struct stat st;
+   Str* path;
+   Str* oldest;
+   time_t oldest_time = 0;
+   unsigned long n;
+
+   path = STR_NEW;
+   oldest = STR_NEW;
+
+   do
+   {
+      n = 0;
+      str_clear (oldest);
+      d = opendir (dir);
+      if ((d == NULL) || (path == NULL) || (oldest == NULL))
+      {
+         break;
+      }
+
+      while ((entry = readdir (d)) != NULL)
+      {
+         if (strncmp (entry->d_name, CACHE_PREFIX, strlen (CACHE_PREFIX))
+             == 0)
+         {
+            str_set (path, dir);
+            str_append_cstr (path, "/");
+            str_append_cstr (path, entry->d_name);
+            if (stat (str_get (path), &st) == 0)
+            {
+               if ((n == 0) || (st.st_mtime < oldest_time))
+               {
+                  oldest_time = st.st_mtime;
+                  str_cpy (oldest, path);
+               }
+               n++;
+            }
+         }
+      }
+      closedir (d);
+
+      if (n > max_entries)
+      {
+         unlink (str_get (oldest));
+      }
+   } while (n > (max_entries + 1));
+
+   str_delete (path);
+   str_delete (oldest);
+}
+
+/* Store a design in the cache. The entry is written to a temporary file
+   first and then renamed, so concurrent runs never see partial entries. */
+static int
+brot_cache_store (const char* dir,
+                  const unsigned long max_entries,
+                  const Str* key,
+                  const char* seq,
+                  const double design_time)
+{
+   Str* path;
+   Str* tmp_path;
+   GFile* file = NULL;
+   int error = 0;
+
+   path = brot_cache_path (dir, key, NULL);
+   tmp_path = brot_cache_path (dir, key, "tmp");
+   if ((path == NULL) || (tmp_path == NULL))
+   {
+      error = 1;
+   }
+
+   if (!error)
+   {
+      file = GFILE_OPEN (str_get (tmp_path), str_length (tmp_path),
+                         GFILE_VOID, "w");
+      if (file == NULL)
+      {
+         error = 1;
+      }
+   }
+
+   if (!error)
+   {
+      if (gfile_printf (file, "%ssequence %s\ntime %f\n", str_get (key), seq,
+                        design_time) < 0)
+      {
+         error = 1;
+      }
+      error |= gfile_close (file);
+   }
+
+   if (!error)
+   {
+      if (rename (str_get (tmp_path), str_get (path)) != 0)
+      {
+         THROW_ERROR_MSG ("Storing design in cache \"%s\" failed:",
+                          str_get (path));
+         unlink (str_get (tmp_path));
+         error = 1;
+      }
+   }
+
+   if (!error)
+   {
+      brot_cache_evict (dir, max_entries);
+   }
+
+   str_delete (path);
+   str_delete (tmp_path);
+
+   return error;
+}
+
+/* Add a target to a batch. Without a name, targets are numbered. */
+static int
+brot_batch_add (BrotBatch* batch, const char* name, const char* structure,
+                const unsigned long size, const float temperature)
+{
+   BrotTarget* list;
+   BrotTarget* target;
+   char buf[32];
+
+   list = XREALLOC (batch->list, (batch->n + 1) * sizeof (*list));
+   if (list == NULL)
+   {
+      return 1;
+   }
+   batch->list = list;
+   target = &(batch->list[batch->n]);
+
+   if ((name == NULL) || (*name == '\0'))
+   {
+      msnprintf (buf, sizeof (buf), "%lu", batch->n + 1);
+      name = buf;
+   }
+
+   target->name = XMALLOC ((strlen (name) + 1) * sizeof (*(target->name)));
+   target->structure = XMALLOC ((size + 1) * sizeof (*(target->structure)));
+   if ((target->name == NULL) || (target->structure == NULL))
+   {
+      XFREE (target->name);
+      XFREE (target->structure);
+      return 1;
+   }
+   strcpy (target->name, name);
+   strncpy (target->structure, structure, size);
+   target->structure[size] = '\0';
+   target->size  = size;
+   target->seq   = NULL;
+   target->temperature = temperature;
+   target->scoring = NULL;
+   target->secs  = 0.0;
+   target->error = 0;
+   target->done  = false;
+
+   batch->n++;
+
+   return 0;
+}
+
+/* Read a record in ct format from a batch file, the header line with the
+   no. of bases is already read. The pairs are stored in bracket notation,
+   so pseudoknots are rejected. */
+static char*
+brot_batch_read_ct (const unsigned long size,
+                    char** buf, size_t* buf_size,
+                    unsigned long* line_no,
+                    GFile* file)
+{
+   unsigned long* pairs;
+   unsigned long* stack;
+   unsigned long cols[5];
+   unsigned long i, j, c, depth;
+   char* structure = NULL;
+   char* p;
+   char* endptr;
+   int error = 0;
+
+   pairs = XCALLOC (size, sizeof (*pairs));
+   stack = XMALLOC (size * sizeof (*stack));
+   if ((pairs == NULL) || (stack == NULL))
+   {
+      XFREE (pairs);
+      XFREE (stack);
+      return NULL;
+   }
+
+   /* base lines: position, base, 5' & 3' neighbours, partner, position */
+   for (i = 0; (!error) && (i < size); i++)
+   {
+      if (gfile_getline_verbatim (&error, buf, buf_size, file) == 0)
+      {
+         THROW_ERROR_MSG ("Batch file \"%s\", line %lu: ct record ends "
+                          "after %lu of %lu bases.",
+                          str_get (gfile_get_path (file)), *line_no, i, size);
+         error = 1;
+         break;
+      }
+      (*line_no)++;
+
+      p = *buf;
+      for (c = 0; (!error) && (c < 5); c++)
+      {
+         if (c == 1)
+         {
+            /* skip the base */
+            while (*p == ' ' || *p == '\t')
+            {
+               p++;
+            }
+            while ((*p != ' ') && (*p != '\t') && (*p != '\0'))
+            {
+               p++;
+            }
+         }
+         cols[c] = strtoul (p, &endptr, 10);
+         if (endptr == p)
+         {
+            THROW_ERROR_MSG ("Batch file \"%s\", line %lu: Not a line of "
+                             "a ct record: \"%s\".",
+                             str_get (gfile_get_path (file)), *line_no, *buf);
+            error = 1;
+         }
+         p = endptr;
+      }
+
+      if ((!error) && ((cols[0] != (i + 1)) || (cols[4] != (i + 1))))
+      {
+         THROW_ERROR_MSG ("Batch file \"%s\", line %lu: Expected base %lu "
+                          "of the ct record.",
+                          str_get (gfile_get_path (file)), *line_no, i + 1);
+         error = 1;
+      }
+      if ((!error) && ((cols[3] > size) || (cols[3] == (i + 1))))
+      {
+         THROW_ERROR_MSG ("Batch file \"%s\", line %lu: Base %lu pairs with "
+                          "base %lu of a record of %lu bases.",
+                          str_get (gfile_get_path (file)), *line_no, i + 1,
+                          cols[3], size);
+         error = 1;
+      }
+      if (!error)
+      {
+         pairs[i] = cols[3];
+      }
+   }
+
+   /* pairs have to be mutual and nested */
+   depth = 0;
+   for (i = 0; (!error) && (i < size); i++)
+   {
+      j = pairs[i];
+      if ((j != 0) && (pairs[j - 1] != (i + 1)))
+      {
+         THROW_ERROR_MSG ("Batch file \"%s\": ct record ending in line %lu: "
+                          "Base %lu pairs with base %lu which pairs with "
+                          "base %lu.", str_get (gfile_get_path (file)),
+                          *line_no, i + 1, j, pairs[j - 1]);
+         error = 1;
+      }
+      else if (j > (i + 1))
+      {
+         stack[depth] = i + 1;
+         depth++;
+      }
+      else if (j != 0)
+      {
+         if ((depth == 0) || (stack[depth - 1] != j))
+         {
+            THROW_ERROR_MSG ("Batch file \"%s\": ct record ending in line "
+                             "%lu: Pseudoknot at base pair (%lu, %lu).",
+                             str_get (gfile_get_path (file)), *line_no, j,
+                             i + 1);
+            error = 1;
+         }
+         depth--;
+      }
+   }
+
+   if (!error)
+   {
+      structure = XMALLOC ((size + 1) * sizeof (*structure));
+   }
+   if (structure != NULL)
+   {
+      for (i = 0; i < size; i++)
+      {
+         if (pairs[i] == 0)
+         {
+            structure[i] = '.';
+         }
+         else
+         {
+            structure[i] = (pairs[i] > (i + 1)) ? '(' : ')';
+         }
+      }
+      structure[size] = '\0';
+   }
+
+   XFREE (pairs);
+   XFREE (stack);
+
+   return structure;
+}
+
+/* Read the targets of a batch run from a file. Empty lines and lines
+   starting with '#' are skipped. A line starting with '>' names the next
+   target. A line starting with a number is the header of a record in ct
+   format, its title names the target if not already named. Otherwise a
+   line holds a structure in bracket notation, anything following the
+   structure is ignored. */
+static int
+brot_batch_read (const char* path, BrotBatch* batch)
+{
+   GFile* file;
+   char* buf = NULL;
+   size_t buf_size = 0;
+   char* name = NULL;
+   char* structure;
+   char* p;
+   char* endptr;
+   unsigned long line_no = 0;
+   unsigned long size;
+   float temperature;
+   int error = 0;
+
+   file = GFILE_OPEN (path, strlen (path), GFILE_VOID, "r");
+   if (file == NULL)
+   {
+      return 1;
+   }
+
+   while ((!error) && (gfile_getline_verbatim (&error, &buf, &buf_size, file)
+                       > 0))
+   {
+      line_no++;
+      p = buf;
+      while ((*p == ' ') || (*p == '\t'))
+      {
+         p++;
+      }
+
+      if ((*p == '\0') || (*p == '#'))
+      {
+         continue;
+      }
+
+      if (*p == '>')
+      {
+         p++;
+         while ((*p == ' ') || (*p == '\t'))
+         {
+            p++;
+         }
+         XFREE (name);
+         name = XMALLOC ((strlen (p) + 1) * sizeof (*name));
+         if (name == NULL)
+         {
+            error = 1;
+         }
+         else
+         {
+            strcpy (name, p);
+         }
+      }
+      else if ((*p >= '0') && (*p <= '9'))
+      {
+         size = strtoul (p, &endptr, 10);
+         if (size == 0)
+         {
+            THROW_ERROR_MSG ("Batch file \"%s\", line %lu: ct record of "
+                             "size 0.", path, line_no);
+            error = 1;
+         }
+         else
+         {
+            while ((*endptr == ' ') || (*endptr == '\t'))
+            {
+               endptr++;
+            }
+            if ((name == NULL) && (*endptr != '\0'))
+            {
+               name = XMALLOC ((strlen (endptr) + 1) * sizeof (*name));
+               if (name != NULL)
+               {
+                  strcpy (name, endptr);
+               }
+            }
+            structure = brot_batch_read_ct (size, &buf, &buf_size, &line_no,
+                                            file);
+            if (structure == NULL)
+            {
+               error = 1;
+            }
+            else
+            {
+               error = brot_batch_add (batch, name, structure, size,
+                                       batch->brot_args->fold_temperature_arg);
+               XFREE (structure);
+            }
+         }
+         XFREE (name);
+         name = NULL;
+      }
+      else
+      {
+         size = 0;
+         while ((p[size] != '\0') && (p[size] != ' ') && (p[size] != '\t'))
+         {
+            size++;
+         }
+
+         /* optional temperature following the structure */
+         temperature = batch->brot_args->fold_temperature_arg;
+         endptr = p + size;
+         while ((*endptr == ' ') || (*endptr == '\t'))
+         {
+            endptr++;
+         }
+         if (*endptr != '\0')
+         {
+            temperature = strtof (endptr, &endptr);
+            while ((*endptr == ' ') || (*endptr == '\t'))
+            {
+               endptr++;
+            }
+            if ((*endptr != '\0') || (temperature <= -273.15f))
+            {
+               THROW_ERROR_MSG ("Batch file \"%s\", line %lu: invalid "
+                                "temperature following the structure.",
+                                path, line_no);
+               error = 1;
+            }
+         }
+
+         if (!error)
+         {
+            error = brot_batch_add (batch, name, p, size, temperature);
+         }
+         XFREE (name);
+         name = NULL;
+      }
+   }
+
+   if (error)
+   {
+      gfile_close (file);
+   }
+   else
+   {
+      error = gfile_close (file);
+   }
+   XFREE (buf);
+   XFREE (name);
+
+   return error;
+}
+
+static double
+brot_wall_time (void)
+{
+   struct timeval tv;
+
+   gettimeofday (&tv, NULL);
+
+   return (double) tv.tv_sec + ((double) tv.tv_usec / 1000000.0);
+}
+
+/* Design a single target of a batch, taking it from the cache if possible */
+static int
+design_target (BrotTarget* target, BrotBatch* batch)
+{
+   Scmf_Rna_Opt_data* data;
+   SeqMatrix* sm = NULL;
+   Str* cache_key = NULL;
+   const char* seq;
+   double design_time;
+   double start = brot_wall_time();
+   const struct brot_args_info* brot_args = batch->brot_args;
+   int error = 0;
+
+   if (  (brot_args->scoring_arg != scoring_arg_nussinov)
+       &&(target->size < 2))
+   {
+      THROW_ERROR_MSG (NN_2_SMALL_WARNING, target->structure, target->size);
+      return 1;
+   }
+
+   if (  (brot_args->window_size_arg > 0)
+       &&((unsigned long) brot_args->window_size_arg
+          > (target->size / 2 - 1)))
+   {
+      THROW_ERROR_MSG ("Option \"--window_size\" must be less than or equal "
+                       "to half of the size of the input structure. Is: "
+                       "\"%ld\", allowed: \"%lu\"",
+                       brot_args->window_size_arg, target->size / 2 - 1);
+      return 1;
+   }
+
+   data = SCMF_RNA_OPT_DATA_NEW_INIT(target->structure,
+                                     target->size,
+                                     RNA_ALPHABET,
+                                     strlen(RNA_ALPHABET)/2,
+                       ((-1) * ((logf (1 / 0.000001f)) / (target->size))),
+                                     0);
+   if (data == NULL)
+   {
+      return 1;
+   }
+
+   if (brot_args->cache_dir_given)
+   {
+      cache_key = brot_cache_key (brot_args, target->temperature, data);
+      if (cache_key != NULL)
+      {
+         target->seq = brot_cache_lookup (brot_args->cache_dir_arg, cache_key,
+                                          &design_time);
+      }
+   }
+
+   if (target->seq == NULL)
+   {
+      sm = SEQMATRIX_NEW;
+      if (sm == NULL)
+      {
+         error = 1;
+      }
+
+      if (!error)
+      {
+         error = SEQMATRIX_INIT (
+            alphabet_size (scmf_rna_opt_data_get_alphabet (data)),
+            target->size,
+            sm);
+      }
+
+      if (!error)
+      {
+         error = design (batch->brot_args, target->scoring, sm, data, NULL,
+                         NULL);
+      }
 
-      seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB 27.11.09 moved here */
-      seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
+      if (!error)
+      {
+         seq = scmf_rna_opt_data_get_seq (data);
+         target->seq = XMALLOC ((strlen (seq) + 1) * sizeof (*seq));
+         if (target->seq == NULL)
+         {
+            error = 1;
+         }
+         else
+         {
+            strcpy (target->seq, seq);
+         }
+      }
 
-      error = seqmatrix_simulate_scmf (brot_args->steps_arg,
-                                       brot_args->temp_arg,
-                                       brot_args->beta_long_arg,
-                                       brot_args->beta_short_arg,
-                                       brot_args->speedup_threshold_arg,
-                                       brot_args->min_cool_arg,
-                                       /* brot_args->scale_cool_arg,*/
-                                       brot_args->lambda_arg,
-                                       brot_args->sm_entropy_arg,
-                                       entropy_file,
-                                       simulation_file,
-                                       sm,
-                                       data);
+      /* failing to store a design in the cache is not fatal */
+      if ((!error) && (cache_key != NULL))
+      {
+#ifdef HAVE_PTHREAD
+         pthread_mutex_lock (&(batch->cache_lock));
+#endif
+         brot_cache_store (brot_args->cache_dir_arg,
+                           (unsigned long) brot_args->cache_size_arg,
+                           cache_key,
+                           target->seq,
+                           brot_wall_time() - start);
+#ifdef HAVE_PTHREAD
+         pthread_mutex_unlock (&(batch->cache_lock));
+#endif
+      }
    }
 
-   /* collate */
-   if (!error)
+   target->secs = brot_wall_time() - start;
+
+   str_delete (cache_key);
+   seqmatrix_delete (sm);
+   scmf_rna_opt_data_delete (data);
+
+   return error;
+}
+
+/* Write designed targets in input order, as far as all preceding targets
+   are done. */
+static void
+batch_output (BrotBatch* batch)
+{
+   BrotTarget* target;
+
+   while (  (batch->next_out < batch->n)
+          &&(batch->list[batch->next_out].done))
    {
-      /*seqmatrix_print_2_stdout (2, sm);*/
-/* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 moved before simulation*/
+      target = &(batch->list[batch->next_out]);
 
-      error = seqmatrix_collate_is (COLLATE_THRESH,
-                                    brot_args->steps_arg / 2,
-                                    brot_args->temp_arg,
-                                    brot_args->beta_long_arg,
-                                    brot_args->beta_short_arg,
-                                    brot_args->speedup_threshold_arg,
-                                    brot_args->min_cool_arg,
-                                    brot_args->lambda_arg,
-                                    /* brot_args->sm_entropy_arg, */
-                                    sm,
-                                    data);
-      /*error = seqmatrix_collate_mv (sm, data);*/
+      if (target->error)
+      {
+         THROW_ERROR_MSG ("Design of target \"%s\" failed.", target->name);
+         batch->error = 1;
+      }
+      else
+      {
+         mprintf (">%s %.2fs\n%s\n", target->name, target->secs,
+                  target->seq);
+      }
+
+      XFREE (target->seq);
+      target->seq = NULL;
+      batch->next_out++;
    }
+}
 
-   /* first: iterate scmf on secstruct, not sm! */
+/* Thread designing targets: fetch targets, longest first, until all are
+   designed. */
+static void*
+batch_worker (void* arg)
+{
+   BrotBatch* batch = (BrotBatch*) arg;
+   BrotTarget* target;
 
-   nn_scores_delete (scores);
-   scmf_rna_opt_data_set_scores (NULL, data);
-   scmf_rna_opt_data_set_bp_allowed (NULL, data);
+   for (;;)
+   {
+      target = NULL;
+#ifdef HAVE_PTHREAD
+      pthread_mutex_lock (&(batch->lock));
+#endif
+      if (batch->next < batch->n)
+      {
+         target = batch->order[batch->next];
+         batch->next++;
+      }
+#ifdef HAVE_PTHREAD
+      pthread_mutex_unlock (&(batch->lock));
+#endif
+
+      if (target == NULL)
+      {
+         break;
+      }
+
+      target->error = design_target (target, batch);
 
-   XFREE (bp_allowed[0]);
-   XFREE (bp_allowed);
+#ifdef HAVE_PTHREAD
+      pthread_mutex_lock (&(batch->lock));
+#endif
+      target->done = true;
+      batch_output (batch);
+#ifdef HAVE_PTHREAD
+      pthread_mutex_unlock (&(batch->lock));
+#endif
+   }
+
+   return NULL;
+}
+
+#ifdef HAVE_PTHREAD
+static int
+cmp_target_size (const void* a, const void* b)
+{
+   const BrotTarget* ta = *((BrotTarget* const*) a);
+   const BrotTarget* tb = *((BrotTarget* const*) b);
+
+   if (ta->size != tb->size)
+   {
+      return (ta->size > tb->size) ? -1 : 1;
+   }
+
+   return (ta < tb) ? -1 : (ta > tb);
+}
+#endif
+
+/* Set up the scoring of each target of a batch. Targets of the same
+   temperature share a scoring, so parameters are rescaled once per
+   temperature. */
+static int
+brot_batch_scoring (BrotBatch* batch, Alphabet* sigma)
+{
+   BrotScoring** list;
+   float temperature;
+   unsigned long i, j;
+   int error = 0;
+
+   if (batch->brot_args->scoring_arg != scoring_arg_nussinov)
+   {
+      batch->params = brot_params_new (batch->brot_args, sigma);
+      if (batch->params == NULL)
+      {
+         return 1;
+      }
+   }
+
+   for (i = 0; (i < batch->n) && (!error); i++)
+   {
+      temperature = batch->list[i].temperature;
+      if (batch->params == NULL)
+      {
+         temperature = batch->brot_args->fold_temperature_arg;
+      }
+
+      for (j = 0; j < batch->n_scoring; j++)
+      {
+         if (batch->scoring[j]->temperature == temperature)
+         {
+            batch->list[i].scoring = batch->scoring[j];
+            break;
+         }
+      }
+
+      if (batch->list[i].scoring == NULL)
+      {
+         list = XREALLOC (batch->scoring,
+                          (batch->n_scoring + 1) * sizeof (*list));
+         if (list == NULL)
+         {
+            error = 1;
+         }
+         else
+         {
+            batch->scoring = list;
+            list[batch->n_scoring] = brot_scoring_new (batch->brot_args, sigma,
+                                                       batch->params,
+                                                       temperature);
+            if (list[batch->n_scoring] == NULL)
+            {
+               error = 1;
+            }
+            else
+            {
+               batch->list[i].scoring = list[batch->n_scoring];
+               batch->n_scoring++;
+            }
+         }
+      }
+   }
 
    return error;
 }
 
+/* Design all targets of a batch file. The scoring scheme is set up once per
+   temperature and shared by all targets. Threads are spent on targets, not
+   inside, so each target is designed as with a single thread. */
 static int
-simulate_using_nussinov_scoring (const struct brot_args_info* brot_args,
-                                 SeqMatrix* sm, Scmf_Rna_Opt_data* data,
-                                 GFile* entropy_file,
-                                 GFile* simulation_file)
+design_batch (struct brot_args_info* brot_args)
 {
+   BrotBatch batch;
+   struct brot_args_info target_args;
+   Alphabet* sigma = NULL;
+   unsigned long i;
    int error = 0;
-   float** scores
-      = create_scoring_matrix (scmf_rna_opt_data_get_alphabet (data)); 
+#ifdef HAVE_PTHREAD
+   pthread_t* threads = NULL;
+   bool* started = NULL;
+   unsigned long t;
+#endif
+
+   batch.list = NULL;
+   batch.n = 0;
+   batch.order = NULL;
+   batch.next = 0;
+   batch.next_out = 0;
+   batch.error = 0;
+   batch.params = NULL;
+   batch.scoring = NULL;
+   batch.n_scoring = 0;
+
+   target_args = *brot_args;
+   target_args.threads_arg = 1;
+   batch.brot_args = &target_args;
+
+   error = brot_batch_read (brot_args->batch_arg, &batch);
 
-   if (scores == NULL)
+   if (!error)
    {
-      error = 1;
+      print_verbose ("# Targets                 (-b): %lu\n", batch.n);
+      print_verbose ("# Scoring scheme          (-c): ");
+      if (brot_args->scoring_arg == scoring_arg_simpleNN)
+      {
+         print_verbose ("simpleNN\n");
+      }
+      else if (brot_args->scoring_arg == scoring_arg_nussinov)
+      {
+         print_verbose ("nussinov\n");
+      }
+      else
+      {
+         print_verbose ("NN\n");
+      }
+
+      sigma = ALPHABET_NEW_SINGLE (RNA_ALPHABET, strlen (RNA_ALPHABET) / 2);
+      if (sigma == NULL)
+      {
+         error = 1;
+      }
    }
 
-   /* simulate */
    if (!error)
    {
-      scmf_rna_opt_data_set_scores (scores, data);
+      error = brot_batch_scoring (&batch, sigma);
+   }
 
-      /* seqmatrix_set_func_calc_eeff_row (seqmatrix_calc_eeff_row_scmf, sm);*/
-      seqmatrix_set_func_calc_cell_energy (scmf_rna_opt_calc_nussinov, sm);
+   if ((!error) && (batch.n > 0))
+   {
+      batch.order = XMALLOC (batch.n * sizeof (*(batch.order)));
+      if (batch.order == NULL)
+      {
+         error = 1;
+      }
+   }
 
-      seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); /* SB 27.11.09 moved here */
-      seqmatrix_set_get_seq_string (scmf_rna_opt_data_get_seq_sm, sm);
+   if ((!error) && (batch.n > 0))
+   {
+      for (i = 0; i < batch.n; i++)
+      {
+         batch.order[i] = &(batch.list[i]);
+      }
 
-      error = seqmatrix_simulate_scmf (brot_args->steps_arg,
-                                       brot_args->temp_arg,
-                                       brot_args->beta_long_arg,
-                                       brot_args->beta_short_arg,
-                                       brot_args->speedup_threshold_arg,
-                                       brot_args->min_cool_arg,
-                                       /*brot_args->scale_cool_arg,*/
-                                       brot_args->lambda_arg,
-                                       brot_args->sm_entropy_arg,
-                                       entropy_file,
-                                       simulation_file,
-                                       sm,
-                                       data);
+#ifdef HAVE_PTHREAD
+      qsort (batch.order, batch.n, sizeof (*(batch.order)), cmp_target_size);
+
+      pthread_mutex_init (&(batch.lock), NULL);
+      pthread_mutex_init (&(batch.cache_lock), NULL);
+
+      if (brot_args->threads_arg > 1)
+      {
+         threads = XMALLOC ((unsigned long) (brot_args->threads_arg - 1)
+                            * sizeof (*threads));
+         started = XCALLOC ((unsigned long) (brot_args->threads_arg - 1),
+                            sizeof (*started));
+         if ((threads == NULL) || (started == NULL))
+         {
+            error = 1;
+         }
+      }
+
+      if (!error)
+      {
+         /* if threads can not be started, the remaining ones pick up their
+            work */
+         for (t = 0; t < (unsigned long) (brot_args->threads_arg - 1); t++)
+         {
+            started[t] = (pthread_create (&(threads[t]), NULL,
+                                          batch_worker, &batch) == 0);
+         }
+         batch_worker (&batch);
+
+         for (t = 0; t < (unsigned long) (brot_args->threads_arg - 1); t++)
+         {
+            if (started[t])
+            {
+               pthread_join (threads[t], NULL);
+            }
+         }
+      }
+
+      pthread_mutex_destroy (&(batch.lock));
+      pthread_mutex_destroy (&(batch.cache_lock));
+      XFREE (threads);
+      XFREE (started);
+#else
+      batch_worker (&batch);
+#endif
    }
 
    if (!error)
    {
-/* seqmatrix_set_transform_row (scmf_rna_opt_data_transform_row_2_base, sm); SB 27.11.09 moved before simulation starts */
-
-      error = seqmatrix_collate_is (COLLATE_THRESH,
-                                    brot_args->steps_arg / 2,
-                                    brot_args->temp_arg,
-                                    brot_args->beta_long_arg,
-                                    brot_args->beta_short_arg,
-                                    brot_args->speedup_threshold_arg,
-                                    brot_args->min_cool_arg,
-                                    brot_args->lambda_arg,
-                                    /* brot_args->sm_entropy_arg, */
-                                    sm,
-                                    data);
-      /* error = seqmatrix_collate_mv (sm, sigma); */
+      error = batch.error;
    }
 
-   scmf_rna_opt_data_set_scores (NULL, data);
-   XFREE_2D ((void**)scores);
+   for (i = 0; i < batch.n; i++)
+   {
+      XFREE (batch.list[i].name);
+      XFREE (batch.list[i].structure);
+      XFREE (batch.list[i].seq);
+   }
+   XFREE (batch.list);
+   XFREE (batch.order);
+   for (i = 0; i < batch.n_scoring; i++)
+   {
+      brot_scoring_delete (batch.scoring[i]);
+   }
+   XFREE (batch.scoring);
+   brot_params_delete (batch.params);
+   alphabet_delete (sigma);
 
    return error;
 }
@@ -629,6 +2609,12 @@ brot_main(const char *cmdline)
    Scmf_Rna_Opt_data* sim_data = NULL;
    GFile* entropy_file = NULL;
    GFile* simulation_file = NULL;
+   BrotScoring* scoring = NULL;
+   BrotParams* params = NULL;
+   Str* cache_key = NULL;
+   char* cached_seq = NULL;
+   double design_time = 0.0;
+   clock_t design_start = clock();
 
    /* command line parsing */
    brot_cmdline_parser_init (&brot_args);
@@ -646,6 +2632,15 @@ brot_main(const char *cmdline)
       retval = brot_cmdline_parser_postprocess (&brot_args, cmdline);
    }
 
+   /* designing a batch of structures: everything is done per target */
+   if ((retval == 0) && brot_args.batch_given)
+   {
+      retval = design_batch (&brot_args);
+      brot_cmdline_parser_free (&brot_args);
+
+      return (retval == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
+
    /* init simulation data */
    if (retval == 0)
    {
@@ -661,8 +2656,45 @@ brot_main(const char *cmdline)
       }
    }
 
+   /* look up design cache */
+   if ((retval == 0) && brot_args.cache_dir_given)
+   {
+      if (brot_args.cache_size_arg < 1)
+      {
+         THROW_ERROR_MSG ("Option \"--cache-size\" requires positive integer "
+                          "as argument, found: %ld", brot_args.cache_size_arg);
+         retval = 1;
+      }
+      else
+      {
+         cache_key = brot_cache_key (&brot_args,
+                                     brot_args.fold_temperature_arg,
+                                     sim_data);
+      }
+
+      print_verbose ("# Design cache            (-K): %s: ",
+                     brot_args.cache_dir_arg);
+      if (cache_key != NULL)
+      {
+         cached_seq = brot_cache_lookup (brot_args.cache_dir_arg, cache_key,
+                                         &design_time);
+         if (cached_seq != NULL)
+         {
+            print_verbose ("hit, designed in %.2fs\n", design_time);
+         }
+         else
+         {
+            print_verbose ("miss\n");
+         }
+      }
+      else
+      {
+         print_verbose ("bypassed\n");
+      }
+   }
+
    /* init matrix */
-   if (retval == 0)
+   if ((retval == 0) && (cached_seq == NULL))
    {
       sm = SEQMATRIX_NEW;
       if (sm != NULL)
@@ -681,7 +2713,7 @@ brot_main(const char *cmdline)
    }
 
    /* fix certain sites in the matrix */
-   if (retval == 0)
+   if ((retval == 0) && (cached_seq == NULL))
    {
       retval = adopt_site_presettings (&brot_args,
                                       scmf_rna_opt_data_get_alphabet (sim_data),
@@ -689,8 +2721,17 @@ brot_main(const char *cmdline)
                                        sm);
    }
 
+   /* warm start from a given sequence */
+   if ((retval == 0) && (cached_seq == NULL) && brot_args.seed_sequence_given)
+   {
+      retval = adopt_seed_sequence (&brot_args,
+                                    scmf_rna_opt_data_get_alphabet (sim_data),
+                                    sm);
+      brot_args.temp_arg = brot_args.seed_temp_arg;
+   }
+
    /* open entropy file if name given */
-   if (retval == 0)
+   if ((retval == 0) && (cached_seq == NULL))
    {
       print_verbose ("# Entropy file            (-p): ");
       if (brot_args.entropy_output_given)
@@ -735,59 +2776,65 @@ brot_main(const char *cmdline)
       }
    }
    
-   if (retval == 0)
+   if ((retval == 0) && (cached_seq == NULL))
    {
       print_verbose ("\n# Scoring scheme          (-c): ");
 
       if (brot_args.scoring_arg == scoring_arg_simpleNN)
       {
          print_verbose ("simpleNN\n");
-         /* special to NN usage: structure has to be of size >= 2 */
-         if (strlen (brot_args.inputs[1]) > 1)
-         {
-            retval = simulate_using_simplenn_scoring (&brot_args,
-                                                      sm,
-                                                      sim_data,
-                                                      entropy_file,
-                                                      simulation_file);
-         }
-         else
-         {
-            THROW_ERROR_MSG (NN_2_SMALL_WARNING,
-                             brot_args.inputs[1], 
-                             (unsigned long) strlen (brot_args.inputs[1]));
-            retval = 1;
-         }
       }
       else if (brot_args.scoring_arg == scoring_arg_nussinov)
       {
          print_verbose ("nussinov\n");
-         retval = simulate_using_nussinov_scoring (&brot_args,
-                                                   sm,
-                                                   sim_data,
-                                                   entropy_file,
-                                                   simulation_file);
       }
       else if (brot_args.scoring_arg == scoring_arg_NN)
       {
          print_verbose ("NN\n");
-         /* special to NN usage: structure has to be of size >= 2 */
-         if (strlen (brot_args.inputs[1]) > 1)
-         {
-            retval = simulate_using_nn_scoring (&brot_args,
-                                                sm,
-                                                sim_data,
-                                                entropy_file,
-                                                simulation_file);
-         }
-         else
-         {
-            THROW_ERROR_MSG (NN_2_SMALL_WARNING,
-                             brot_args.inputs[1], 
-                             (unsigned long) strlen (brot_args.inputs[1]));
-            retval = 1;
-         }
       }
+
+      /* special to NN usage: structure has to be of size >= 2 */
+      if (  (brot_args.scoring_arg != scoring_arg_nussinov)
+          &&(strlen (brot_args.inputs[1]) < 2))
+      {
+         THROW_ERROR_MSG (NN_2_SMALL_WARNING,
+                          brot_args.inputs[1], 
+                          (unsigned long) strlen (brot_args.inputs[1]));
+         retval = 1;
+      }
+   }
+
+   if (  (retval == 0) && (cached_seq == NULL)
+       &&(brot_args.scoring_arg != scoring_arg_nussinov))
+   {
+      params = brot_params_new (&brot_args,
+                                scmf_rna_opt_data_get_alphabet (sim_data));
+      if (params == NULL)
+      {
+         retval = 1;
+      }
+   }
+
+   if ((retval == 0) && (cached_seq == NULL))
+   {
+      scoring = brot_scoring_new (&brot_args,
+                                  scmf_rna_opt_data_get_alphabet (sim_data),
+                                  params,
+                                  brot_args.fold_temperature_arg);
+      if (scoring == NULL)
+      {
+         retval = 1;
+      }
+   }
+
+   if ((retval == 0) && (cached_seq == NULL))
+   {
+      retval = design (&brot_args,
+                       scoring,
+                       sm,
+                       sim_data,
+                       entropy_file,
+                       simulation_file);
    }
 
    /* close files */
@@ -817,16 +2864,38 @@ brot_main(const char *cmdline)
       gfile_close (simulation_file);
    }
 
+   /* store new designs in the cache, failing to do so is not fatal */
+   if ((retval == 0) && (cached_seq == NULL) && (cache_key != NULL))
+   {
+      design_time = (double) (clock() - design_start) / CLOCKS_PER_SEC;
+      brot_cache_store (brot_args.cache_dir_arg,
+                        (unsigned long) brot_args.cache_size_arg,
+                        cache_key,
+                        scmf_rna_opt_data_get_seq(sim_data),
+                        design_time);
+   }
+
    if (retval == 0)
    {
       /*seqmatrix_print_2_stdout (2, sm);*/
-      mprintf ("%s\n", scmf_rna_opt_data_get_seq(sim_data));
+      if (cached_seq != NULL)
+      {
+         mprintf ("%s\n", cached_seq);
+      }
+      else
+      {
+         mprintf ("%s\n", scmf_rna_opt_data_get_seq(sim_data));
+      }
    }
 
    /* finalise */
+   str_delete (cache_key);
+   XFREE (cached_seq);
    brot_cmdline_parser_free (&brot_args);
    seqmatrix_delete (sm);
    scmf_rna_opt_data_delete (sim_data);
+   brot_scoring_delete (scoring);
+   brot_params_delete (params);
 
    if (retval == 0)
    {
@@ -71,6 +71,36 @@ const char *brot_args_info_detailed_help[] = {
   "  If the ratio of current short- and long term entropy drops                  \n  below this value, we slow down cooling, above we speed up.",
   "  -j, --min-cool=FLOAT          Minimal cooling factor  (default=`0.866')",
   "  If the cooling factor drops below this value we do no further                 \n   speedups.",
+  "  -T, --threads=INT             Number of threads  (default=`1')",
+  "  Number of threads used for evaluating the structure elements                  \n  in each step of the simulation. Only takes effect when using                  \n  `NN' as scoring scheme and if CoRB was built with support                  \n  for POSIX threads.",
+  "  -W, --neg-span=INT            Maximum span of unwanted pairs  (default=`0')",
+  "  Maximum distance of the bases of unwanted pairs considered in                 \n  the negative design term. With 0, unwanted pairs are                  \n  approximated over the whole sequence. Only takes effect                  \n  when using `NN' as scoring scheme.",
+  "  -A, --neg-all-pairs           Count all unwanted pairs",
+  "  Consider unwanted pairs of any span in the negative design                  \n  term, exactly instead of approximated. Overrides                  \n  --neg-span. Only takes effect when using `NN' as scoring                  \n  scheme.",
+  "  -D, --decompose               Design domains separately",
+  "  Split the structure at the stems of the external loop, design                  \n  each domain on its own and finish with a short simulation                  \n  of the whole structure, starting from the designed domains.                  \n  Domains are designed in parallel if more than one thread is                  \n  used.",
+  "  -H, --helix-first             Design stems first",
+  "  Simulate in two stages: First only paired sites are                  \n  designed while unpaired sites stay at their initial                  \n  distribution. Then all sites are released for a second                  \n  shorter stage, starting at a lower temperature. Not                  \n  available for the `simpleNN' scoring scheme.",
+  "  -S, --seed-sequence=SEQUENCE  Start from a sequence",
+  "  Bias the initial sequence matrix towards a given sequence                  \n  instead of starting from an even distribution. Used to                  \n  redesign a sequence after small changes to its structure.                  \n  Fixed sites (-n) take precedence.",
+  "  -P, --seed-confidence=FLOAT   Share of the seed sequence  (default=`0.9')",
+  "  Initial probability of the bases of the seed sequence. The                  \n  rest is distributed evenly over the other bases of a site.",
+  "  -I, --seed-temp=FLOAT         Initial temperature for seeded runs  \n                                  (default=`1')",
+  "  Replaces the initial temperature (-t) if a seed sequence is                  \n  given, since a seeded matrix needs less annealing.",
+  "  -K, --cache-dir=DIR           Cache designs in a directory",
+  "  Look up the design in a cache directory before simulating and                  \n  store new designs there. Runs without a fixed seed (-r) using                  \n  NN scoring or writing entropy (-p) or matrix (-m) output                  \n  bypass the cache.",
+  "  -N, --cache-size=INT          Max. no. of cached designs  (default=`1000')",
+  "  If the cache directory holds more designs, the least recently                  \n  used ones are removed.",
+  "  -b, --batch=FILE              Design sequences for all structures of a file",
+  "  Read target structures from a file instead of the command                  \n  line: one structure in bracket notation per line, optionally                  \n  preceded by a '>' line naming it, or records in ct format.                  \n  Targets are scheduled longest first on the threads (-T), the                  \n  designs are written in input order with the time spent on                  \n  each.",
+  "  -E, --energy-params=FILE      Read energy parameters from a file",
+  "  Use the nearest neighbour parameters of a file instead of the                  \n  built-in ones for NN and simpleNN scoring. Tables missing in                  \n  the file keep their built-in values. A binary image of the                  \n  parameters is kept next to the file (FILE.img) to speed up                  \n  later runs.",
+  "  -F, --fold-temperature=FLOAT  Temperature to design for  (default=`37')",
+  "  Rescale the nearest neighbour parameters to a temperature in                  \n  degree Celsius. Without enthalpies (-Y), loop penalties are                  \n  taken as purely entropic while stacking energies keep their                  \n  values. In batch mode (-b), a temperature following a                  \n  structure overrides this one for the target.",
+  "  -Y, --enthalpy-params=FILE    Read enthalpies from a file",
+  "  Enthalpies for rescaling the energy parameters to the                  \n  temperature (-F), in the format of energy parameter files                  \n  (-E). Tables missing in the file keep the built-in parameters,                  \n  i.e. are taken as temperature independent.",
+  "  -R, --dirty-tolerance=FLOAT   Tolerated change of structure elements  \n                                  (default=`0.001')",
+  "  Structure elements of the NN model are only recalculated once                  \n  the probabilities of their sites changed by more than this                  \n  value since their last calculation, adding up the largest                  \n  change of each step. With 0, every element touching a changed                  \n  site is recalculated in each step. Only takes effect when                  \n  using `NN' as scoring scheme.",
     0
 };
 static void
@@ -98,11 +128,26 @@ init_full_help_array(void)
   brot_args_info_full_help[19] = brot_args_info_detailed_help[34];
   brot_args_info_full_help[20] = brot_args_info_detailed_help[36];
   brot_args_info_full_help[21] = brot_args_info_detailed_help[38];
-  brot_args_info_full_help[22] = 0; 
+  brot_args_info_full_help[22] = brot_args_info_detailed_help[40];
+  brot_args_info_full_help[23] = brot_args_info_detailed_help[42];
+  brot_args_info_full_help[24] = brot_args_info_detailed_help[44];
+  brot_args_info_full_help[25] = brot_args_info_detailed_help[46];
+  brot_args_info_full_help[26] = brot_args_info_detailed_help[48];
+  brot_args_info_full_help[27] = brot_args_info_detailed_help[50];
+  brot_args_info_full_help[28] = brot_args_info_detailed_help[52];
+  brot_args_info_full_help[29] = brot_args_info_detailed_help[54];
+  brot_args_info_full_help[30] = brot_args_info_detailed_help[56];
+  brot_args_info_full_help[31] = brot_args_info_detailed_help[58];
+  brot_args_info_full_help[32] = brot_args_info_detailed_help[60];
+  brot_args_info_full_help[33] = brot_args_info_detailed_help[62];
+  brot_args_info_full_help[34] = brot_args_info_detailed_help[64];
+  brot_args_info_full_help[35] = brot_args_info_detailed_help[66];
+  brot_args_info_full_help[36] = brot_args_info_detailed_help[68];
+  brot_args_info_full_help[37] = 0; 
   
 }
 
-const char *brot_args_info_full_help[23];
+const char *brot_args_info_full_help[38];
 
 static void
 init_help_array(void)
@@ -122,11 +167,18 @@ init_help_array(void)
   brot_args_info_help[12] = brot_args_info_detailed_help[20];
   brot_args_info_help[13] = brot_args_info_detailed_help[22];
   brot_args_info_help[14] = brot_args_info_detailed_help[24];
-  brot_args_info_help[15] = 0; 
+  brot_args_info_help[15] = brot_args_info_detailed_help[40];
+  brot_args_info_help[16] = brot_args_info_detailed_help[50];
+  brot_args_info_help[17] = brot_args_info_detailed_help[56];
+  brot_args_info_help[18] = brot_args_info_detailed_help[60];
+  brot_args_info_help[19] = brot_args_info_detailed_help[62];
+  brot_args_info_help[20] = brot_args_info_detailed_help[64];
+  brot_args_info_help[21] = brot_args_info_detailed_help[66];
+  brot_args_info_help[22] = 0; 
   
 }
 
-const char *brot_args_info_help[16];
+const char *brot_args_info_help[23];
 
 typedef enum {ARG_NO
   , ARG_STRING
@@ -201,6 +253,21 @@ void clear_given (struct brot_args_info *args_info)
   args_info->beta_short_given = 0 ;
   args_info->speedup_threshold_given = 0 ;
   args_info->min_cool_given = 0 ;
+  args_info->threads_given = 0 ;
+  args_info->neg_span_given = 0 ;
+  args_info->neg_all_pairs_given = 0 ;
+  args_info->decompose_given = 0 ;
+  args_info->helix_first_given = 0 ;
+  args_info->seed_sequence_given = 0 ;
+  args_info->seed_confidence_given = 0 ;
+  args_info->seed_temp_given = 0 ;
+  args_info->cache_dir_given = 0 ;
+  args_info->cache_size_given = 0 ;
+  args_info->batch_given = 0 ;
+  args_info->energy_params_given = 0 ;
+  args_info->fold_temperature_given = 0 ;
+  args_info->enthalpy_params_given = 0 ;
+  args_info->dirty_tolerance_given = 0 ;
 }
 
 static
@@ -238,6 +305,30 @@ void clear_args (struct brot_args_info *args_info)
   args_info->speedup_threshold_orig = NULL;
   args_info->min_cool_arg = 0.866;
   args_info->min_cool_orig = NULL;
+  args_info->threads_arg = 1;
+  args_info->threads_orig = NULL;
+  args_info->neg_span_arg = 0;
+  args_info->neg_span_orig = NULL;
+  args_info->seed_sequence_arg = NULL;
+  args_info->seed_sequence_orig = NULL;
+  args_info->seed_confidence_arg = 0.9;
+  args_info->seed_confidence_orig = NULL;
+  args_info->seed_temp_arg = 1;
+  args_info->seed_temp_orig = NULL;
+  args_info->cache_dir_arg = NULL;
+  args_info->cache_dir_orig = NULL;
+  args_info->cache_size_arg = 1000;
+  args_info->cache_size_orig = NULL;
+  args_info->batch_arg = NULL;
+  args_info->batch_orig = NULL;
+  args_info->energy_params_arg = NULL;
+  args_info->energy_params_orig = NULL;
+  args_info->fold_temperature_arg = 37;
+  args_info->fold_temperature_orig = NULL;
+  args_info->enthalpy_params_arg = NULL;
+  args_info->enthalpy_params_orig = NULL;
+  args_info->dirty_tolerance_arg = 0.001;
+  args_info->dirty_tolerance_orig = NULL;
   
 }
 
@@ -270,6 +361,21 @@ void init_args_info(struct brot_args_info *args_info)
   args_info->beta_short_help = brot_args_info_detailed_help[34] ;
   args_info->speedup_threshold_help = brot_args_info_detailed_help[36] ;
   args_info->min_cool_help = brot_args_info_detailed_help[38] ;
+  args_info->threads_help = brot_args_info_detailed_help[40] ;
+  args_info->neg_span_help = brot_args_info_detailed_help[42] ;
+  args_info->neg_all_pairs_help = brot_args_info_detailed_help[44] ;
+  args_info->decompose_help = brot_args_info_detailed_help[46] ;
+  args_info->helix_first_help = brot_args_info_detailed_help[48] ;
+  args_info->seed_sequence_help = brot_args_info_detailed_help[50] ;
+  args_info->seed_confidence_help = brot_args_info_detailed_help[52] ;
+  args_info->seed_temp_help = brot_args_info_detailed_help[54] ;
+  args_info->cache_dir_help = brot_args_info_detailed_help[56] ;
+  args_info->cache_size_help = brot_args_info_detailed_help[58] ;
+  args_info->batch_help = brot_args_info_detailed_help[60] ;
+  args_info->energy_params_help = brot_args_info_detailed_help[62] ;
+  args_info->fold_temperature_help = brot_args_info_detailed_help[64] ;
+  args_info->enthalpy_params_help = brot_args_info_detailed_help[66] ;
+  args_info->dirty_tolerance_help = brot_args_info_detailed_help[68] ;
   
 }
 
@@ -433,6 +539,23 @@ brot_cmdline_parser_release (struct brot_args_info *args_info)
   free_string_field (&(args_info->beta_short_orig));
   free_string_field (&(args_info->speedup_threshold_orig));
   free_string_field (&(args_info->min_cool_orig));
+  free_string_field (&(args_info->threads_orig));
+  free_string_field (&(args_info->neg_span_orig));
+  free_string_field (&(args_info->seed_sequence_arg));
+  free_string_field (&(args_info->seed_sequence_orig));
+  free_string_field (&(args_info->seed_confidence_orig));
+  free_string_field (&(args_info->seed_temp_orig));
+  free_string_field (&(args_info->cache_dir_arg));
+  free_string_field (&(args_info->cache_dir_orig));
+  free_string_field (&(args_info->cache_size_orig));
+  free_string_field (&(args_info->batch_arg));
+  free_string_field (&(args_info->batch_orig));
+  free_string_field (&(args_info->energy_params_arg));
+  free_string_field (&(args_info->energy_params_orig));
+  free_string_field (&(args_info->fold_temperature_orig));
+  free_string_field (&(args_info->enthalpy_params_arg));
+  free_string_field (&(args_info->enthalpy_params_orig));
+  free_string_field (&(args_info->dirty_tolerance_orig));
   
   
   for (i = 0; i < args_info->inputs_num; ++i)
@@ -560,6 +683,36 @@ brot_cmdline_parser_dump(FILE *outfile, struct brot_args_info *args_info)
     write_into_file(outfile, "speedup-threshold", args_info->speedup_threshold_orig, 0);
   if (args_info->min_cool_given)
     write_into_file(outfile, "min-cool", args_info->min_cool_orig, 0);
+  if (args_info->threads_given)
+    write_into_file(outfile, "threads", args_info->threads_orig, 0);
+  if (args_info->neg_span_given)
+    write_into_file(outfile, "neg-span", args_info->neg_span_orig, 0);
+  if (args_info->neg_all_pairs_given)
+    write_into_file(outfile, "neg-all-pairs", 0, 0 );
+  if (args_info->decompose_given)
+    write_into_file(outfile, "decompose", 0, 0 );
+  if (args_info->helix_first_given)
+    write_into_file(outfile, "helix-first", 0, 0 );
+  if (args_info->seed_sequence_given)
+    write_into_file(outfile, "seed-sequence", args_info->seed_sequence_orig, 0);
+  if (args_info->seed_confidence_given)
+    write_into_file(outfile, "seed-confidence", args_info->seed_confidence_orig, 0);
+  if (args_info->seed_temp_given)
+    write_into_file(outfile, "seed-temp", args_info->seed_temp_orig, 0);
+  if (args_info->cache_dir_given)
+    write_into_file(outfile, "cache-dir", args_info->cache_dir_orig, 0);
+  if (args_info->cache_size_given)
+    write_into_file(outfile, "cache-size", args_info->cache_size_orig, 0);
+  if (args_info->batch_given)
+    write_into_file(outfile, "batch", args_info->batch_orig, 0);
+  if (args_info->energy_params_given)
+    write_into_file(outfile, "energy-params", args_info->energy_params_orig, 0);
+  if (args_info->fold_temperature_given)
+    write_into_file(outfile, "fold-temperature", args_info->fold_temperature_orig, 0);
+  if (args_info->enthalpy_params_given)
+    write_into_file(outfile, "enthalpy-params", args_info->enthalpy_params_orig, 0);
+  if (args_info->dirty_tolerance_given)
+    write_into_file(outfile, "dirty-tolerance", args_info->dirty_tolerance_orig, 0);
   
 
   i = EXIT_SUCCESS;
@@ -1766,6 +1919,21 @@ brot_cmdline_parser_internal (
         { "beta-short",	1, NULL, 'i' },
         { "speedup-threshold",	1, NULL, 'u' },
         { "min-cool",	1, NULL, 'j' },
+        { "threads",	1, NULL, 'T' },
+        { "neg-span",	1, NULL, 'W' },
+        { "neg-all-pairs",	0, NULL, 'A' },
+        { "decompose",	0, NULL, 'D' },
+        { "helix-first",	0, NULL, 'H' },
+        { "seed-sequence",	1, NULL, 'S' },
+        { "seed-confidence",	1, NULL, 'P' },
+        { "seed-temp",	1, NULL, 'I' },
+        { "cache-dir",	1, NULL, 'K' },
+        { "cache-size",	1, NULL, 'N' },
+        { "batch",	1, NULL, 'b' },
+        { "energy-params",	1, NULL, 'E' },
+        { "fold-temperature",	1, NULL, 'F' },
+        { "enthalpy-params",	1, NULL, 'Y' },
+        { "dirty-tolerance",	1, NULL, 'R' },
         { 0,  0, 0, 0 }
       };
 
@@ -1774,7 +1942,7 @@ brot_cmdline_parser_internal (
       custom_opterr = opterr;
       custom_optopt = optopt;
 
-      c = custom_getopt_long (argc, argv, "Vvfc:n:s:t:r:d:h:p:m:w:e:l:o:i:u:j:", long_options, &option_index);
+      c = custom_getopt_long (argc, argv, "Vvfc:n:s:t:r:d:h:p:m:w:e:l:o:i:u:j:T:W:ADHS:P:I:K:N:b:E:F:Y:R:", long_options, &option_index);
 
       optarg = custom_optarg;
       optind = custom_optind;
@@ -2003,6 +2171,186 @@ brot_cmdline_parser_internal (
             goto failure;
         
           break;
+        case 'T':	/* Number of threads.  */
+        
+        
+          if (update_arg( (void *)&(args_info->threads_arg), 
+               &(args_info->threads_orig), &(args_info->threads_given),
+              &(local_args_info.threads_given), optarg, 0, "1", ARG_LONG,
+              check_ambiguity, override, 0, 0,
+              "threads", 'T',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'W':	/* Maximum span of unwanted pairs.  */
+        
+        
+          if (update_arg( (void *)&(args_info->neg_span_arg), 
+               &(args_info->neg_span_orig), &(args_info->neg_span_given),
+              &(local_args_info.neg_span_given), optarg, 0, "0", ARG_LONG,
+              check_ambiguity, override, 0, 0,
+              "neg-span", 'W',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'A':	/* Count all unwanted pairs.  */
+        
+        
+          if (update_arg( 0 , 
+               0 , &(args_info->neg_all_pairs_given),
+              &(local_args_info.neg_all_pairs_given), optarg, 0, 0, ARG_NO,
+              check_ambiguity, override, 0, 0,
+              "neg-all-pairs", 'A',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'D':	/* Design domains separately.  */
+        
+        
+          if (update_arg( 0 , 
+               0 , &(args_info->decompose_given),
+              &(local_args_info.decompose_given), optarg, 0, 0, ARG_NO,
+              check_ambiguity, override, 0, 0,
+              "decompose", 'D',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'H':	/* Design stems first.  */
+        
+        
+          if (update_arg( 0 , 
+               0 , &(args_info->helix_first_given),
+              &(local_args_info.helix_first_given), optarg, 0, 0, ARG_NO,
+              check_ambiguity, override, 0, 0,
+              "helix-first", 'H',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'S':	/* Start from a sequence.  */
+        
+        
+          if (update_arg( (void *)&(args_info->seed_sequence_arg), 
+               &(args_info->seed_sequence_orig), &(args_info->seed_sequence_given),
+              &(local_args_info.seed_sequence_given), optarg, 0, 0, ARG_STRING,
+              check_ambiguity, override, 0, 0,
+              "seed-sequence", 'S',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'P':	/* Share of the seed sequence.  */
+        
+        
+          if (update_arg( (void *)&(args_info->seed_confidence_arg), 
+               &(args_info->seed_confidence_orig), &(args_info->seed_confidence_given),
+              &(local_args_info.seed_confidence_given), optarg, 0, "0.9", ARG_FLOAT,
+              check_ambiguity, override, 0, 0,
+              "seed-confidence", 'P',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'I':	/* Initial temperature for seeded runs.  */
+        
+        
+          if (update_arg( (void *)&(args_info->seed_temp_arg), 
+               &(args_info->seed_temp_orig), &(args_info->seed_temp_given),
+              &(local_args_info.seed_temp_given), optarg, 0, "1", ARG_FLOAT,
+              check_ambiguity, override, 0, 0,
+              "seed-temp", 'I',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'K':	/* Cache designs in a directory.  */
+        
+        
+          if (update_arg( (void *)&(args_info->cache_dir_arg), 
+               &(args_info->cache_dir_orig), &(args_info->cache_dir_given),
+              &(local_args_info.cache_dir_given), optarg, 0, 0, ARG_STRING,
+              check_ambiguity, override, 0, 0,
+              "cache-dir", 'K',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'N':	/* Max. no. of cached designs.  */
+        
+        
+          if (update_arg( (void *)&(args_info->cache_size_arg), 
+               &(args_info->cache_size_orig), &(args_info->cache_size_given),
+              &(local_args_info.cache_size_given), optarg, 0, "1000", ARG_LONG,
+              check_ambiguity, override, 0, 0,
+              "cache-size", 'N',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'b':	/* Design sequences for all structures of a file.  */
+        
+        
+          if (update_arg( (void *)&(args_info->batch_arg), 
+               &(args_info->batch_orig), &(args_info->batch_given),
+              &(local_args_info.batch_given), optarg, 0, 0, ARG_STRING,
+              check_ambiguity, override, 0, 0,
+              "batch", 'b',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'E':	/* Read energy parameters from a file.  */
+        
+        
+          if (update_arg( (void *)&(args_info->energy_params_arg), 
+               &(args_info->energy_params_orig), &(args_info->energy_params_given),
+              &(local_args_info.energy_params_given), optarg, 0, 0, ARG_STRING,
+              check_ambiguity, override, 0, 0,
+              "energy-params", 'E',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'F':	/* Temperature to design for.  */
+        
+        
+          if (update_arg( (void *)&(args_info->fold_temperature_arg), 
+               &(args_info->fold_temperature_orig), &(args_info->fold_temperature_given),
+              &(local_args_info.fold_temperature_given), optarg, 0, "37", ARG_FLOAT,
+              check_ambiguity, override, 0, 0,
+              "fold-temperature", 'F',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'Y':	/* Read enthalpies from a file.  */
+        
+        
+          if (update_arg( (void *)&(args_info->enthalpy_params_arg), 
+               &(args_info->enthalpy_params_orig), &(args_info->enthalpy_params_given),
+              &(local_args_info.enthalpy_params_given), optarg, 0, 0, ARG_STRING,
+              check_ambiguity, override, 0, 0,
+              "enthalpy-params", 'Y',
+              additional_error))
+            goto failure;
+        
+          break;
+        case 'R':	/* Tolerated change of structure elements.  */
+        
+        
+          if (update_arg( (void *)&(args_info->dirty_tolerance_arg), 
+               &(args_info->dirty_tolerance_orig), &(args_info->dirty_tolerance_given),
+              &(local_args_info.dirty_tolerance_given), optarg, 0, "0.001", ARG_FLOAT,
+              check_ambiguity, override, 0, 0,
+              "dirty-tolerance", 'R',
+              additional_error))
+            goto failure;
+        
+          break;
 
         case 0:	/* Long option with no short option */
           if (strcmp (long_options[option_index].name, "help") == 0) {
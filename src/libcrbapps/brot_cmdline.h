@@ -90,6 +90,45 @@ struct brot_args_info
   float min_cool_arg;	/**< @brief Minimal cooling factor (default='0.866').  */
   char * min_cool_orig;	/**< @brief Minimal cooling factor original value given at command line.  */
   const char *min_cool_help; /**< @brief Minimal cooling factor help description.  */
+  long threads_arg;	/**< @brief Number of threads (default='1').  */
+  char * threads_orig;	/**< @brief Number of threads original value given at command line.  */
+  const char *threads_help; /**< @brief Number of threads help description.  */
+  long neg_span_arg;	/**< @brief Maximum span of unwanted pairs (default='0').  */
+  char * neg_span_orig;	/**< @brief Maximum span of unwanted pairs original value given at command line.  */
+  const char *neg_span_help; /**< @brief Maximum span of unwanted pairs help description.  */
+  const char *neg_all_pairs_help; /**< @brief Count all unwanted pairs help description.  */
+  const char *decompose_help; /**< @brief Design domains separately help description.  */
+  const char *helix_first_help; /**< @brief Design stems first help description.  */
+  char * seed_sequence_arg;	/**< @brief Start from a sequence.  */
+  char * seed_sequence_orig;	/**< @brief Start from a sequence original value given at command line.  */
+  const char *seed_sequence_help; /**< @brief Start from a sequence help description.  */
+  float seed_confidence_arg;	/**< @brief Share of the seed sequence (default='0.9').  */
+  char * seed_confidence_orig;	/**< @brief Share of the seed sequence original value given at command line.  */
+  const char *seed_confidence_help; /**< @brief Share of the seed sequence help description.  */
+  float seed_temp_arg;	/**< @brief Initial temperature for seeded runs (default='1').  */
+  char * seed_temp_orig;	/**< @brief Initial temperature for seeded runs original value given at command line.  */
+  const char *seed_temp_help; /**< @brief Initial temperature for seeded runs help description.  */
+  char * cache_dir_arg;	/**< @brief Cache designs in a directory.  */
+  char * cache_dir_orig;	/**< @brief Cache designs in a directory original value given at command line.  */
+  const char *cache_dir_help; /**< @brief Cache designs in a directory help description.  */
+  long cache_size_arg;	/**< @brief Max. no. of cached designs (default='1000').  */
+  char * cache_size_orig;	/**< @brief Max. no. of cached designs original value given at command line.  */
+  const char *cache_size_help; /**< @brief Max. no. of cached designs help description.  */
+  char * batch_arg;	/**< @brief Design sequences for all structures of a file.  */
+  char * batch_orig;	/**< @brief Design sequences for all structures of a file original value given at command line.  */
+  const char *batch_help; /**< @brief Design sequences for all structures of a file help description.  */
+  char * energy_params_arg;	/**< @brief Read energy parameters from a file.  */
+  char * energy_params_orig;	/**< @brief Read energy parameters from a file original value given at command line.  */
+  const char *energy_params_help; /**< @brief Read energy parameters from a file help description.  */
+  float fold_temperature_arg;	/**< @brief Temperature to design for (default='37').  */
+  char * fold_temperature_orig;	/**< @brief Temperature to design for original value given at command line.  */
+  const char *fold_temperature_help; /**< @brief Temperature to design for help description.  */
+  char * enthalpy_params_arg;	/**< @brief Read enthalpies from a file.  */
+  char * enthalpy_params_orig;	/**< @brief Read enthalpies from a file original value given at command line.  */
+  const char *enthalpy_params_help; /**< @brief Read enthalpies from a file help description.  */
+  float dirty_tolerance_arg;	/**< @brief Tolerated change of structure elements (default='0.001').  */
+  char * dirty_tolerance_orig;	/**< @brief Tolerated change of structure elements original value given at command line.  */
+  const char *dirty_tolerance_help; /**< @brief Tolerated change of structure elements help description.  */
   
   unsigned int help_given ;	/**< @brief Whether help was given.  */
   unsigned int detailed_help_given ;	/**< @brief Whether detailed-help was given.  */
@@ -113,6 +152,21 @@ struct brot_args_info
   unsigned int beta_short_given ;	/**< @brief Whether beta-short was given.  */
   unsigned int speedup_threshold_given ;	/**< @brief Whether speedup-threshold was given.  */
   unsigned int min_cool_given ;	/**< @brief Whether min-cool was given.  */
+  unsigned int threads_given ;	/**< @brief Whether threads was given.  */
+  unsigned int neg_span_given ;	/**< @brief Whether neg-span was given.  */
+  unsigned int neg_all_pairs_given ;	/**< @brief Whether neg-all-pairs was given.  */
+  unsigned int decompose_given ;	/**< @brief Whether decompose was given.  */
+  unsigned int helix_first_given ;	/**< @brief Whether helix-first was given.  */
+  unsigned int seed_sequence_given ;	/**< @brief Whether seed-sequence was given.  */
+  unsigned int seed_confidence_given ;	/**< @brief Whether seed-confidence was given.  */
+  unsigned int seed_temp_given ;	/**< @brief Whether seed-temp was given.  */
+  unsigned int cache_dir_given ;	/**< @brief Whether cache-dir was given.  */
+  unsigned int cache_size_given ;	/**< @brief Whether cache-size was given.  */
+  unsigned int batch_given ;	/**< @brief Whether batch was given.  */
+  unsigned int energy_params_given ;	/**< @brief Whether energy-params was given.  */
+  unsigned int fold_temperature_given ;	/**< @brief Whether fold-temperature was given.  */
+  unsigned int enthalpy_params_given ;	/**< @brief Whether enthalpy-params was given.  */
+  unsigned int dirty_tolerance_given ;	/**< @brief Whether dirty-tolerance was given.  */
 
   char **inputs ; /**< @brief unamed options (options without names) */
   unsigned inputs_num ; /**< @brief unamed options number */
@@ -24,6 +24,7 @@
  *
  *  Revision History:
  *         - 2008Sep24 bienert: created
+ *         - 2026Oct18 bienert: Evaluate with integer tables
  *
  */
 
@@ -72,6 +73,7 @@ er2de_main(const char *cmdline)
    Rna* rna = NULL;
    Alphabet* sigma = NULL;
    NN_scores* scores = NULL;
+   NN_int_scores* int_scores = NULL;
    int G = 0;
    struct er2de_args_info erde_args;
    unsigned long tmp = 0;
@@ -146,13 +148,23 @@ er2de_main(const char *cmdline)
       retval = RNA_SECSTRUCT_INIT (rna);
    }
 
+   /* integer tables, no loop is longer than the sequence */
+   if (retval == 0)
+   {
+      int_scores = NN_INT_SCORES_NEW (scores, rna_get_size (rna));
+      if (int_scores == NULL)
+      {
+         retval = 1;
+      }
+   }
+
    /* calculate free energy */
    if (retval == 0)
    {
       /* nn_scores_fprintf_tetra_loop(stdout, scores, sigma); */
-      G = secstruct_calculate_DG (rna_get_sequence(rna),
-                                  scores,
-                                  rna_get_secstruct(rna));
+      G = secstruct_calculate_DG_int (rna_get_sequence(rna),
+                                      int_scores,
+                                      rna_get_secstruct(rna));
       mfprintf (stdout, "G = %5.2f\n", G * 0.01);
    }
 
@@ -160,6 +172,7 @@ er2de_main(const char *cmdline)
    er2de_cmdline_parser_free (&erde_args);
    rna_delete (rna);
    alphabet_delete (sigma);
+   nn_int_scores_delete (int_scores);
    nn_scores_delete (scores);
 
    if (retval == 0)
@@ -58,5 +58,6 @@
 #include "undef.h"      /* undefined flags for basic datatypes */
 #include "genarray.h"   /* generic array macros */
 #include "gfile.h"      /* generic file handling */
+#include "rng.h"        /* random number streams */
 
 #endif /* CRBBASIC_H */
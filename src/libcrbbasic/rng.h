@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Stefan Bienert
+ *
+ * This file is part of CoRB.
+ *
+ * CoRB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CoRB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CoRB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ ****   Documentation header   ***
+ *
+ *  @file libcrbbasic/rng.h
+ *
+ *  @brief Counter based random number streams
+ *
+ *  Module: rng
+ *
+ *  Library: crbbasic
+ *
+ *  Project: CoRB - Collection of RNAanalysis Binaries
+ *
+ *  @author Stefan Bienert
+ *
+ *  @date 2026-10-18
+ *
+ *
+ *  Revision History:
+ *         - 2026Oct18 bienert: created
+ *         - 2026Oct18 bienert: Added random access to streams
+ *
+ */
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#ifndef RNG_H
+#define RNG_H
+
+
+/* State of a stream. The i-th number of a stream only depends on its key and
+   i, so streams do not share anything and may be used by different threads
+   at once. */
+typedef struct {
+      uint64_t key;               /* derived from seed and stream no. */
+      uint64_t counter;           /* no. of numbers drawn so far */
+} Rng;
+
+
+/*******************************   Initialise   *******************************/
+
+extern void
+rng_init (const unsigned long, const unsigned long, Rng*);
+
+
+/*********************************   Access   *********************************/
+
+extern uint64_t
+rng_next (Rng*);
+
+extern double
+rng_uniform (Rng*);
+
+extern double
+rng_uniform_at (const uint64_t, const Rng*);
+
+
+#endif /* RNG_H */
+
+#ifdef __cplusplus
+}
+#endif
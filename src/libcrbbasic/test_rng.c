@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Stefan Bienert
+ *
+ * This file is part of CoRB.
+ *
+ * CoRB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CoRB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CoRB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ ****   Documentation header   ***
+ *
+ *  @file libcrbbasic/test_rng.c
+ *
+ *  @brief Test for counter based random number streams
+ *
+ *  Module: rng
+ *
+ *  Library: crbbasic
+ *
+ *  Project: CoRB - Collection of RNAanalysis Binaries
+ *
+ *  @author Stefan Bienert
+ *
+ *  @date 2026-10-18
+ *
+ *
+ *  Revision History:
+ *         - 2026Oct18 bienert: created
+ *         - 2026Oct18 bienert: Added random access to streams
+ *
+ */
+
+
+#include <config.h>
+#include <stdlib.h>
+#include "memmgr.h"
+#include "errormsg.h"
+#include "rng.h"
+
+#define TEST_DRAWS 100000
+
+
+int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
+{
+   Rng s1, s2, s3;
+   uint64_t first[8];
+   unsigned long i, same;
+   double u, sum = 0.0;
+
+   /* same seed and stream: same numbers, even if interleaved with others */
+   THROW_WARN_MSG ("Checking reproducibility of streams.");
+   rng_init (42, 0, &s1);
+   for (i = 0; i < 8; i++)
+   {
+      first[i] = rng_next (&s1);
+   }
+   rng_init (42, 0, &s1);
+   rng_init (42, 1, &s2);
+   for (i = 0; i < 8; i++)
+   {
+      rng_next (&s2);
+      if (rng_next (&s1) != first[i])
+      {
+         THROW_ERROR_MSG ("Stream does not reproduce number %lu", i);
+         return EXIT_FAILURE;
+      }
+   }
+
+   /* other stream or seed: other numbers */
+   THROW_WARN_MSG ("Checking independence of streams.");
+   rng_init (42, 1, &s2);
+   rng_init (43, 0, &s3);
+   same = 0;
+   for (i = 0; i < 8; i++)
+   {
+      if (rng_next (&s2) == first[i])
+      {
+         same++;
+      }
+      if (rng_next (&s3) == first[i])
+      {
+         same++;
+      }
+   }
+   if (same > 0)
+   {
+      THROW_ERROR_MSG ("Different streams share %lu numbers", same);
+      return EXIT_FAILURE;
+   }
+
+   /* uniform numbers stay in [0, 1) and average to 1/2 */
+   THROW_WARN_MSG ("Checking range of uniform numbers.");
+   rng_init (42, 2, &s1);
+   for (i = 0; i < TEST_DRAWS; i++)
+   {
+      u = rng_uniform (&s1);
+      if ((u < 0.0) || (u >= 1.0))
+      {
+         THROW_ERROR_MSG ("Uniform number out of range: %g", u);
+         return EXIT_FAILURE;
+      }
+      sum += u;
+   }
+   sum /= TEST_DRAWS;
+   if ((sum < 0.49) || (sum > 0.51))
+   {
+      THROW_ERROR_MSG ("Mean of %d uniform numbers is off: %g", TEST_DRAWS,
+                       sum);
+      return EXIT_FAILURE;
+   }
+
+   /* random access yields the numbers of sequential draws */
+   THROW_WARN_MSG ("Checking random access to streams.");
+   rng_init (42, 3, &s1);
+   rng_init (42, 3, &s2);
+   for (i = 1; i <= 8; i++)
+   {
+      u = rng_uniform (&s1);
+      if (rng_uniform_at (i, &s2) != u)
+      {
+         THROW_ERROR_MSG ("Random access does not reproduce number %lu", i);
+         return EXIT_FAILURE;
+      }
+   }
+   if (s2.counter != 0)
+   {
+      THROW_ERROR_MSG ("Random access alters the stream");
+      return EXIT_FAILURE;
+   }
+
+   FREE_MEMORY_MANAGER;
+
+   return EXIT_SUCCESS;
+}
@@ -49,11 +49,56 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
 #include <libcrbbasic/crbbasic.h>
 #include <libcrbrna/crbrna.h>
 #include "seqmatrix.h"
 #include "scmf_rna_opt.h"
 
+/* min. probability of a tetraloop to be considered in the hairpin term */
+#define SCMF_TL_EPSILON 1e-9f
+
+/* default tolerance for the change of the columns of a structure element
+   before it is recalculated, see scmf_rna_opt_data_set_dirty_tolerance() */
+#define SCMF_DIRTY_TOLERANCE 0.001f
+
+/* contribution of a structure element to a cell of the Eeff matrix */
+typedef struct {
+      unsigned long row;
+      unsigned long col;
+      float value;
+} EeffCell;
+
+ARRAY_CREATE_CLASS(EeffCell);
+
+/* kinds of structure elements, in the order they are evaluated */
+typedef enum {
+   SCMF_ELEM_INTERNAL,
+   SCMF_ELEM_TETRA,
+   SCMF_ELEM_EXT,
+   SCMF_ELEM_STACK,
+   SCMF_ELEM_BULGE,
+   SCMF_ELEM_HAIRPIN,
+   SCMF_ELEM_MULTI
+} ScmfElemKind;
+
+/* a structure element: its kind and index in the list of its kind */
+typedef struct {
+      ScmfElemKind kind;
+      unsigned long idx;
+} ScmfElem;
+
+/* structure element due for recalculation with estimated costs */
+typedef struct {
+      unsigned long elem;
+      unsigned long cost;
+} ScmfDirtyElem;
+
+#ifdef HAVE_PTHREAD
+typedef struct ScmfElemWorker ScmfElemWorker;
+typedef struct ScmfElemQueue ScmfElemQueue;
+#endif
+
 struct Scmf_Rna_Opt_data {
       void* scores;
       Alphabet* sigma;    /* alphabet */
@@ -62,12 +107,128 @@ struct Scmf_Rna_Opt_data {
       float het_rate;     /* rate of decrease for the heterogenity term */
       float het_scale;    /* scaling factor for het term */
       float neg_scale;    /* scaling factor for negative design */
-      float* en_neg;      /* negative energies for incremental updates */
-      float** en_neg2;    /* negative energies for incremental updates */
-      float** en_neg_35;  /* neg.en. for 5' 3' direction */
+      float* neg_pre;     /* prefix sums of dinucleotide probabilities */
+      float* neg_coef;    /* stacking energies for the neg. design term */
+      float** col_agg;    /* per step aggregates over the columns */
       unsigned long win;  /* window size for the het term */
+      unsigned long neg_span; /* max. span of pairs in the neg. design */
+      float* int_scratch; /* buffers for the small internal loop kernels */
+      ArrayEeffCell* elem_cache;  /* Eeff contributions per struct. element */
+      unsigned long n_elems;      /* no. of structure elements */
+      ArrayEeffCell* rec;         /* cache of the element under evaluation */
+      int rec_error;              /* failed to store a contribution */
+      ScmfElem* elems;            /* kind and index of each element */
+      ScmfDirtyElem* dirty;       /* elements to be recalculated */
+      float* drift;               /* change of elements since calculated */
+      float dirty_tol;            /* max. drift of an element kept */
+      unsigned long n_threads;    /* no. of threads for the element sweep */
+#ifdef HAVE_PTHREAD
+      float* thr_scratch;         /* kernel buffers of additional threads */
+      ScmfElemWorker* workers;    /* additional threads of the sweep */
+      unsigned long n_workers;    /* no. of additional threads running */
+      ScmfElemQueue* queue;       /* hands out the work of a sweep */
+#endif
+};
+
+#ifdef HAVE_PTHREAD
+/* dirty structure elements of a sweep shared by the threads. The additional
+   threads are started once and sleep on 'start' between sweeps. A new sweep
+   is handed out by increasing 'round', the last thread finishing it
+   signals 'done'. */
+struct ScmfElemQueue {
+      const ScmfDirtyElem* list;
+      unsigned long n;
+      unsigned long next;         /* next element to be processed */
+      SeqMatrix* sm;
+      unsigned long alpha_size;
+      unsigned long allowed_bp;
+      unsigned long round;        /* no. of sweeps handed out so far */
+      unsigned long active;       /* threads still busy with the sweep */
+      bool stop;                  /* threads have to terminate */
+      pthread_mutex_t lock;
+      pthread_cond_t start;
+      pthread_cond_t done;
+};
+
+/* an additional thread of the element sweep works on its own copy of the
+   data object, sharing all read-only parts but having own kernel buffers.
+   The copy is taken when the thread is started and refreshed by the setters
+   of the data object. Since each element records into its own cache, no
+   further locking is needed. */
+struct ScmfElemWorker {
+      Scmf_Rna_Opt_data data;
+      ScmfElemQueue* queue;
+      unsigned long round;        /* last sweep taken part in */
+      pthread_t thread;
 };
 
+/* Refresh the copies of the data object held by the threads of the element
+   sweep. Must not be called while a sweep is running. */
+static void
+scmf_rna_opt_sync_workers (Scmf_Rna_Opt_data* this)
+{
+   unsigned long t;
+   float* scratch;
+
+   for (t = 0; t < this->n_workers; t++)
+   {
+      scratch = this->workers[t].data.int_scratch;
+      this->workers[t].data = *this;
+      this->workers[t].data.int_scratch = scratch;
+      this->workers[t].data.rec = NULL;
+      this->workers[t].data.rec_error = 0;
+   }
+}
+
+/* Terminate the threads of the element sweep and free their resources. */
+static void
+scmf_rna_opt_stop_workers (Scmf_Rna_Opt_data* this)
+{
+   unsigned long t;
+
+   if (this->queue != NULL)
+   {
+      pthread_mutex_lock (&(this->queue->lock));
+      this->queue->stop = true;
+      pthread_cond_broadcast (&(this->queue->start));
+      pthread_mutex_unlock (&(this->queue->lock));
+
+      for (t = 0; t < this->n_workers; t++)
+      {
+         pthread_join (this->workers[t].thread, NULL);
+      }
+
+      pthread_cond_destroy (&(this->queue->done));
+      pthread_cond_destroy (&(this->queue->start));
+      pthread_mutex_destroy (&(this->queue->lock));
+   }
+
+   XFREE (this->queue);
+   XFREE (this->workers);
+   XFREE (this->thr_scratch);
+   this->queue = NULL;
+   this->workers = NULL;
+   this->thr_scratch = NULL;
+   this->n_workers = 0;
+}
+
+#define SCMF_SYNC_WORKERS(D) scmf_rna_opt_sync_workers (D)
+#else
+#define SCMF_SYNC_WORKERS(D)
+#endif
+
+/* scratch space for the internal loop kernels: 2 vectors over all base
+   pairs, 8 over the alphabet, the 2x2 table summed over closing pairs, the
+   2x2 table for one pair of closing base pairs and its loop tuples (8 bases
+   each, stored as chars in the space of 2 floats) */
+static __inline__ unsigned long
+scmf_rna_opt_int_scratch_size (const unsigned long alpha_size)
+{
+   return (alpha_size * alpha_size * 2)
+      + (alpha_size * 8)
+      + (alpha_size * alpha_size * alpha_size * alpha_size * 4);
+}
+
 /** @brief Create new data object for cell energy calculations.
  *
  * Creates Scmf_Rna_Opt_data object...
@@ -85,9 +246,26 @@ scmf_rna_opt_data_new (const char* file, const int line)
       cedat->rna        = NULL;
       cedat->bp_allowed = NULL;
       cedat->het_rate   = 0.0f;
-      cedat->en_neg     = NULL;
-      cedat->en_neg2    = NULL;
-      cedat->en_neg_35  = NULL;
+      cedat->neg_pre    = NULL;
+      cedat->neg_coef   = NULL;
+      cedat->neg_span   = 0;
+      cedat->col_agg    = NULL;
+      cedat->int_scratch = NULL;
+      cedat->elem_cache = NULL;
+      cedat->n_elems    = 0;
+      cedat->rec        = NULL;
+      cedat->rec_error  = 0;
+      cedat->elems      = NULL;
+      cedat->dirty      = NULL;
+      cedat->drift      = NULL;
+      cedat->dirty_tol  = SCMF_DIRTY_TOLERANCE;
+      cedat->n_threads  = 1;
+#ifdef HAVE_PTHREAD
+      cedat->thr_scratch = NULL;
+      cedat->workers    = NULL;
+      cedat->n_workers  = 0;
+      cedat->queue      = NULL;
+#endif
       cedat->het_scale  = 1.0f;
       cedat->neg_scale  = 1.0f;
    }
@@ -98,6 +276,8 @@ scmf_rna_opt_data_new (const char* file, const int line)
 void
 scmf_rna_opt_data_delete (Scmf_Rna_Opt_data* cedat)
 {
+   unsigned long i;
+
    if (cedat != NULL)
    {
       assert (cedat->scores == NULL);
@@ -105,9 +285,24 @@ scmf_rna_opt_data_delete (Scmf_Rna_Opt_data* cedat)
 
       alphabet_delete (cedat->sigma);
       rna_delete (cedat->rna);
-      XFREE (cedat->en_neg);
-      XFREE_2D ((void**)cedat->en_neg2);
-      XFREE_2D ((void**)cedat->en_neg_35);
+      XFREE (cedat->neg_pre);
+      XFREE (cedat->neg_coef);
+      XFREE_2D ((void**)cedat->col_agg);
+      XFREE (cedat->int_scratch);
+      if (cedat->elem_cache != NULL)
+      {
+         for (i = 0; i < cedat->n_elems; i++)
+         {
+            ARRAY_DELETE (cedat->elem_cache[i]);
+         }
+         XFREE (cedat->elem_cache);
+      }
+      XFREE (cedat->elems);
+      XFREE (cedat->dirty);
+      XFREE (cedat->drift);
+#ifdef HAVE_PTHREAD
+      scmf_rna_opt_stop_workers (cedat);
+#endif
       XFREE (cedat);
    }
 }
@@ -177,26 +372,42 @@ scmf_rna_opt_data_new_init (const char* structure,
          }
       }
 
-      /* init negative energies */
-      /*alpha_size = alphabet_size (this->sigma);*/
-      this->en_neg = XCALLOC (alpha_size, sizeof (*(this->en_neg)));
-      if (this->en_neg == NULL)
+      /* prefix sums of the negative design term for each site plus two
+         rows of scratch space */
+      this->neg_pre = XMALLOC ((rna_get_size (this->rna) + 2)
+                               * alpha_size * alpha_size
+                               * sizeof (*(this->neg_pre)));
+      if (this->neg_pre == NULL)
+      {
+         scmf_rna_opt_data_delete (this);
+         return NULL;         
+      }
+
+      this->neg_coef = XMALLOC (2 * alpha_size * alpha_size
+                                * alpha_size * alpha_size
+                                * sizeof (*(this->neg_coef)));
+      if (this->neg_coef == NULL)
       {
          scmf_rna_opt_data_delete (this);
          return NULL;         
       }
 
-      this->en_neg2 = (float**) XMALLOC_2D (alpha_size, alpha_size,
-                                            sizeof (**(this->en_neg2)));
-      if (this->en_neg2 == NULL)
+      /* per step aggregates of the nussinov and simpleNN models: 2 for the
+         negative design and 2 for the heterogenity term per state plus 2
+         normalisation vectors. The NN model uses the first ones for its
+         heterogenity term. */
+      this->col_agg = (float**) XMALLOC_2D ((4 * alpha_size) + 2,
+                                            rna_get_size (this->rna),
+                                            sizeof (**(this->col_agg)));
+      if (this->col_agg == NULL)
       {
          scmf_rna_opt_data_delete (this);
          return NULL;         
       }
 
-      this->en_neg_35 = (float**) XMALLOC_2D (alpha_size, alpha_size,
-                                              sizeof (**(this->en_neg_35)));
-      if (this->en_neg_35 == NULL)
+      this->int_scratch = XMALLOC (scmf_rna_opt_int_scratch_size (alpha_size)
+                                   * sizeof (*(this->int_scratch)));
+      if (this->int_scratch == NULL)
       {
          scmf_rna_opt_data_delete (this);
          return NULL;         
@@ -212,10 +423,110 @@ scmf_rna_opt_data_new_init (const char* structure,
    return this;
 }
 
+/* register the n elements of a kind in the list of structure elements */
+static __inline__ unsigned long
+scmf_rna_opt_add_elems (const ScmfElemKind kind,
+                        const unsigned long n,
+                        unsigned long e,
+                        Scmf_Rna_Opt_data* this)
+{
+   unsigned long i;
+
+   for (i = 0; i < n; i++)
+   {
+      this->elems[e].kind = kind;
+      this->elems[e].idx = i;
+      e++;
+   }
+
+   return e;
+}
+
 int
 scmf_rna_opt_data_secstruct_init (Scmf_Rna_Opt_data* this)
 {
-   return RNA_SECSTRUCT_INIT (this->rna);
+   int error;
+   unsigned long i, e;
+   SecStruct* structure;
+
+   assert (this->elem_cache == NULL);
+
+   error = RNA_SECSTRUCT_INIT (this->rna);
+   if (error)
+   {
+      return error;
+   }
+
+   /* one cache of Eeff contributions for each structure element: internal
+      loops, tetraloop bonus of hairpins, the external loop, stacks,
+      bulges, hairpins and multiloops */
+   structure = rna_get_secstruct(this->rna);
+   this->n_elems = secstruct_get_noof_internals (structure)
+      + secstruct_get_noof_hairpins (structure)
+      + 1
+      + secstruct_get_noof_stacks (structure)
+      + secstruct_get_noof_bulges (structure)
+      + secstruct_get_noof_hairpins (structure)
+      + secstruct_get_noof_multiloops (structure);
+
+   this->elem_cache = XMALLOC (this->n_elems * sizeof (*(this->elem_cache)));
+   if (this->elem_cache == NULL)
+   {
+      return 1;
+   }
+
+   for (i = 0; i < this->n_elems; i++)
+   {
+      ARRAY_SET_VOID (this->elem_cache[i]);
+   }
+
+   for (i = 0; i < this->n_elems; i++)
+   {
+      ARRAY_INIT (this->elem_cache[i], 8, EeffCell);
+      if (ARRAY_IS_NULL (this->elem_cache[i]))
+      {
+         return 1;
+      }
+   }
+
+   this->elems = XMALLOC (this->n_elems * sizeof (*(this->elems)));
+   this->dirty = XMALLOC (this->n_elems * sizeof (*(this->dirty)));
+   this->drift = XMALLOC (this->n_elems * sizeof (*(this->drift)));
+   if ((this->elems == NULL) || (this->dirty == NULL) || (this->drift == NULL))
+   {
+      return 1;
+   }
+
+   for (i = 0; i < this->n_elems; i++)
+   {
+      this->drift[i] = 0.0f;
+   }
+
+   e = 0;
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_INTERNAL,
+                               secstruct_get_noof_internals (structure),
+                               e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_TETRA,
+                               secstruct_get_noof_hairpins (structure),
+                               e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_EXT, 1, e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_STACK,
+                               secstruct_get_noof_stacks (structure),
+                               e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_BULGE,
+                               secstruct_get_noof_bulges (structure),
+                               e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_HAIRPIN,
+                               secstruct_get_noof_hairpins (structure),
+                               e, this);
+   e = scmf_rna_opt_add_elems (SCMF_ELEM_MULTI,
+                               secstruct_get_noof_multiloops (structure),
+                               e, this);
+   assert (e == this->n_elems);
+
+   SCMF_SYNC_WORKERS (this);
+
+   return 0;
 }
 
 /* int */
@@ -280,171 +591,227 @@ scmf_rna_opt_data_secstruct_init (Scmf_Rna_Opt_data* this)
 
 /*    return 0; */
 /* } */
-int
-scmf_rna_opt_data_init_negative_design_energies_alt (void* data,
-                                                 SeqMatrix* sm)
+/* Set up the stacking energies of the negative design terms for all states.
+   For state s in a site i, coef[s][x][(a,b)] holds the energies of stacks
+   (s, x, a, b) with b pairing s upstream and x at i + 1, and
+   coef[alpha_size + s][y][(a,b)] holds the energies of stacks (a, s, y, b)
+   with a pairing s downstream and y at i - 1, weighted by dn_weight. (a,b)
+   indexes the dinucleotide probabilities of scmf_rna_opt_calc_neg_pre. */
+static void
+scmf_rna_opt_init_neg_coef (const unsigned long allowed_bp,
+                            const unsigned long alpha_size,
+                            const float dn_weight,
+                            const Scmf_Rna_Opt_data* this)
 {
-   unsigned long /*i,*/ j, k, l, m, cols, alpha, allowed_bp;
-   char bj, bip1, bjm1;
-   float prob;
-   Scmf_Rna_Opt_data* this;
+   unsigned long s, abp, bp;
+   unsigned long a2 = alpha_size * alpha_size;
+   char bp5, bp3, bo;
+   float* c_up;
+   float* c_dn;
 
-   assert (sm);
-   assert (data);
-
-   this = (Scmf_Rna_Opt_data*) data;
-
-   cols = seqmatrix_get_width (sm);
-   alpha = alphabet_size (this->sigma);
-   allowed_bp = nn_scores_no_allowed_basepairs (this->scores);
-   /*i = 0;*/
+   memset (this->neg_coef, 0, 2 * a2 * a2 * sizeof (*(this->neg_coef)));
 
-   memset(this->en_neg2[0], 0, (alpha * alpha) * sizeof (**(this->en_neg2)));
-   memset(this->en_neg_35[0], 0, (alpha * alpha) * sizeof(**(this->en_neg_35)));
-   memset(this->en_neg, 0, alpha * sizeof (*(this->en_neg)));
-
-   /* idea: calculate all neg. contributions for the first column without
-            incorporating the probabilities from this column into the
-            calculation. The probabilities are then used during cell
-            evaluation. */
-   for (j = 1; j < cols; j++)
+   for (s = 0; s < alpha_size; s++)
    {
-      for (k = 0; k < alpha; k++)
+      c_up = this->neg_coef + (s * a2 * alpha_size);
+      c_dn = this->neg_coef + ((alpha_size + s) * a2 * alpha_size);
+
+      for (abp = 0; this->bp_allowed[s][abp] != 0; abp++)
       {
-         /* we only consider allowed base pairs */
-         for (l = 0; this->bp_allowed[k][l] != 0; l++)
+         bo = (char) (this->bp_allowed[s][abp] - 1);
+
+         for (bp = 0; bp < allowed_bp; bp++)
          {
-            bj = this->bp_allowed[k][l] - 1;
-            
-            for (m = 0; m < allowed_bp; m++)
-            {
-               nn_scores_get_allowed_basepair (m, &bip1, &bjm1,
-                                               this->scores);
+            nn_scores_get_allowed_basepair (bp, &bp5, &bp3, this->scores);
 
-               prob = seqmatrix_get_probability (bj,    j,      sm)
-                    * seqmatrix_get_probability (bjm1, (j - 1), sm);
-        
-               this->en_neg2[k][(int)bip1] += (nn_scores_get_G_stack (k, bj,
-                                                                 bjm1, bip1,
-                                                                 this->scores)
-                                               * prob);
-
-               this->en_neg[k] += (nn_scores_get_G_stack (k, bj,
-                                                          bjm1, bip1,
-                                                          this->scores)
-                                   * prob);
-            }
+            /* (s, bo) closing (bp3, bp5): products P(bp5, j-1) P(bo, j) */
+            c_up[(bp3 * a2) + (bp5 * alpha_size) + bo] +=
+               nn_scores_get_G_stack ((char) s, bo, bp5, bp3, this->scores);
+
+            /* (bo, s) closing (bp3, bp5): products P(bo, i) P(bp5, i+1) */
+            c_dn[(bp3 * a2) + (bo * alpha_size) + bp5] +=
+               nn_scores_get_G_stack (bo, (char) s, bp3, bp5, this->scores)
+               * dn_weight;
          }
       }
    }
-
-   /*mfprintf (stderr, "E: %f\n", this->en_neg2[0][0]
-             +this->en_neg2[0][1]
-             +this->en_neg2[0][2]
-             +this->en_neg2[0][3]);
-   mfprintf (stderr, "E: %f\n", this->en_neg[0]);
-   mfprintf (stderr, "E: %f\n", this->en_neg2[1][0]
-             +this->en_neg2[1][1]
-             +this->en_neg2[1][2]
-             +this->en_neg2[1][3]);
-   mfprintf (stderr, "E: %f\n", this->en_neg[1]);
-   mfprintf (stderr, "E: %f\n", this->en_neg2[2][0]
-             +this->en_neg2[2][1]
-             +this->en_neg2[2][2]
-             +this->en_neg2[2][3]);
-   mfprintf (stderr, "E: %f\n", this->en_neg[2]);
-   mfprintf (stderr, "E: %f\n", this->en_neg2[3][0]
-             +this->en_neg2[3][1]
-             +this->en_neg2[3][2]
-             +this->en_neg2[3][3]);
-             mfprintf (stderr, "E: %f\n", this->en_neg[3]);*/
-   return 0;
 }
 
-static __inline__ void
-scmf_rna_opt_iterate_neg_design_term (unsigned long row,
-                                      unsigned long col,
-                                      Scmf_Rna_Opt_data* this,
-                                      SeqMatrix* sm)
+/* Prefix sums of the dinucleotide probabilities for the negative design
+   terms: pre[j][(a,b)] = sum over k in [1, j] of P(a, k-1) P(b, k) */
+static void
+scmf_rna_opt_calc_neg_pre (const unsigned long n_sites,
+                           const unsigned long alpha_size,
+                           const Scmf_Rna_Opt_data* this,
+                           const SeqMatrix* sm)
 {
-   unsigned long j, k;
-   char bi, bj, bip1, bjm1;
-   unsigned long allowed_bp;
+   unsigned long j, x, k;
+   unsigned long a2 = alpha_size * alpha_size;
    float prob;
 
-   assert (this);
-   assert (sm);
-
-   allowed_bp = nn_scores_no_allowed_basepairs (this->scores);
-
-   if ((col + 1) < seqmatrix_get_width(sm))
+   memset (this->neg_pre, 0, a2 * sizeof (*(this->neg_pre)));
+   for (j = 1; j < n_sites; j++)
    {
-      /* update negative energy for next col */
-      /* subtract col, col+1 contribution (5' -> 3') */
-      for (j = 0; this->bp_allowed[row][j] != 0; j++)
+      for (x = 0; x < alpha_size; x++)
       {
-         bj = (char)(this->bp_allowed[row][j] - 1);
-         
-         for (k = 0; k < allowed_bp; k++)
+         prob = seqmatrix_get_probability (x, j - 1, sm);
+         for (k = 0; k < alpha_size; k++)
          {
-            nn_scores_get_allowed_basepair (k, &bip1, &bjm1,
-                                            this->scores);
-            
-            prob = seqmatrix_get_probability (bj, (col + 1), sm)
-               * seqmatrix_get_probability (bjm1, col, sm);
-            
-            this->en_neg2[row][(int)bip1] -= (nn_scores_get_G_stack ((char)row,
-                                                                     bj,
-                                                                     bjm1, bip1,
-                                                                     this->scores)
-                                              * prob);
+            this->neg_pre[(j * a2) + (x * alpha_size) + k] =
+               this->neg_pre[((j - 1) * a2) + (x * alpha_size) + k]
+               + (prob * seqmatrix_get_probability (k, j, sm));
          }
       }
+   }
+}
+
+/* Exponentially weighted sums of the probability of each state over all
+   sites left and right of a site for the heterogenity term of the nussinov
+   and simpleNN models, together with the sums of weights. */
+static void
+scmf_rna_opt_calc_het_aggregates (const unsigned long rows,
+                                  const unsigned long cols,
+                                  const Scmf_Rna_Opt_data* this,
+                                  const SeqMatrix* sm)
+{
+   unsigned long row, j;
+   float* h_l;                    /* het. term, left of j */
+   float* h_r;                    /* het. term, right of j */
+   float* cnt_l;                  /* het. normalisation, left of j */
+   float* cnt_r;                  /* het. normalisation, right of j */
+   float decay;
+
+   decay = expf (this->het_rate);
+
+   cnt_l = this->col_agg[4 * rows];
+   cnt_r = this->col_agg[(4 * rows) + 1];
+   cnt_l[0] = 0.0f;
+   cnt_r[cols - 1] = 0.0f;
+   for (j = 1; j < cols; j++)
+   {
+      cnt_l[j] = (cnt_l[j - 1] * decay) + 1.0f;
+      cnt_r[cols - 1 - j] = (cnt_r[cols - j] * decay) + 1.0f;
+   }
 
-      /* update negative energy for next col */
-      /* add col+1, col contribution (5' <- 3') */
-      for (j = 0; this->bp_allowed[row][j] != 0; j++)
+   for (row = 0; row < rows; row++)
+   {
+      h_l = this->col_agg[(2 * rows) + row];
+      h_r = this->col_agg[(3 * rows) + row];
+
+      h_l[0] = 0.0f;
+      for (j = 1; j < cols; j++)
       {
-         bi = (char)(this->bp_allowed[row][j] - 1);
-         
-         for (k = 0; k < allowed_bp; k++)
-         {
-            nn_scores_get_allowed_basepair (k, &bip1, &bjm1,
-                                            this->scores);
-            
-            prob = seqmatrix_get_probability (bi, col, sm)
-               * seqmatrix_get_probability (bip1, (col + 1), sm);
-            
-            this->en_neg_35[row][(int)bjm1] += (nn_scores_get_G_stack (bi,
-                                                                      (char)row,
-                                                                       bjm1, bip1,
-                                                                       this->scores)
-                                                * prob);
-         }
+         h_l[j] = (h_l[j - 1] * decay)
+            + seqmatrix_get_probability (row, j - 1, sm);
+      }
+
+      h_r[cols - 1] = 0.0f;
+      for (j = cols - 1; j > 0; j--)
+      {
+         h_r[j - 1] = (h_r[j] * decay) + seqmatrix_get_probability (row, j, sm);
       }
    }
 }
 
+/* Weight of a site in the heterogenity term of another one */
+static __inline__ float
+scmf_rna_opt_het_weight (const unsigned long col,
+                         const unsigned long site,
+                         const Scmf_Rna_Opt_data* this)
+{
+   if (col < site)
+   {
+      return expf (this->het_rate * (site - (col + 1)));
+   }
+
+   return expf (this->het_rate * (col - (site + 1)));
+}
+
+/** @brief Prepare the per step aggregates for the simpleNN model.
+ *
+ * To be registered as pre column iteration hook for the simpleNN model. For
+ * each state and site, all stacks with any possible pairing partner (first
+ * order approximation of the negative design term) are summed up from the
+ * prefix sums of the dinucleotide probabilities, shared by all states. The
+ * cell function then only has to remove the wanted interaction.\n
+ * Returns 0.
+ *
+ * @params[in] data Data object.
+ * @params[in] sm Sequence matrix.
+ */
 int
-scmf_rna_opt_data_update_neg_design_energy (void* data,
-                                            unsigned long col,
-                                            SeqMatrix* sm)
+scmf_rna_opt_data_init_negative_design_energies_alt (void* data,
+                                                 SeqMatrix* sm)
 {
+   unsigned long j, s, x, k, cols, alpha, a2, allowed_bp;
+   float* pre;
+   float* last;
+   float* c;
+   float en_up, en_dn, neg;
    Scmf_Rna_Opt_data* this;
-   unsigned long rows, i;
 
    assert (sm);
    assert (data);
-   
-   rows = seqmatrix_get_rows (sm);
 
    this = (Scmf_Rna_Opt_data*) data;
 
-   for (i = 0; i < rows; i++)
+   cols = seqmatrix_get_width (sm);
+   alpha = alphabet_size (this->sigma);
+   a2 = alpha * alpha;
+   allowed_bp = nn_scores_no_allowed_basepairs (this->scores);
+
+   assert (this->col_agg);
+   assert (cols <= rna_get_size (this->rna));
+   assert (seqmatrix_get_rows (sm) == alpha);
+
+   scmf_rna_opt_init_neg_coef (allowed_bp, alpha, 1.0f, this);
+   scmf_rna_opt_calc_neg_pre (cols, alpha, this, sm);
+   last = this->neg_pre + ((cols - 1) * a2);
+
+   for (j = 0; j < cols; j++)
    {
-      scmf_rna_opt_iterate_neg_design_term (i, col, this, sm);
+      pre = this->neg_pre + (j * a2);
+
+      for (s = 0; s < alpha; s++)
+      {
+         neg = 0.0f;
+
+         /* stacks with the base upstream, partners right of j */
+         if ((j + 1) < cols)
+         {
+            c = this->neg_coef + (s * a2 * alpha);
+            for (x = 0; x < alpha; x++)
+            {
+               en_up = 0.0f;
+               for (k = 0; k < a2; k++)
+               {
+                  en_up += c[(x * a2) + k] * (last[k] - pre[k]);
+               }
+               neg += (en_up * seqmatrix_get_probability (x, j + 1, sm));
+            }
+         }
+
+         /* stacks with the base downstream, partners left of j */
+         if (j > 0)
+         {
+            c = this->neg_coef + ((alpha + s) * a2 * alpha);
+            for (x = 0; x < alpha; x++)
+            {
+               en_dn = 0.0f;
+               for (k = 0; k < a2; k++)
+               {
+                  en_dn += c[(x * a2) + k] * pre[k];
+               }
+               neg += (en_dn * seqmatrix_get_probability (x, j - 1, sm));
+            }
+         }
+
+         this->col_agg[s][j] = neg;
+      }
    }
 
+   scmf_rna_opt_calc_het_aggregates (alpha, cols, this, sm);
+
    return 0;
 }
 
@@ -455,6 +822,7 @@ scmf_rna_opt_data_set_scores (void* scores,
    assert (cedat);
 
    cedat->scores = scores;
+   SCMF_SYNC_WORKERS (cedat);
 }
 
 void
@@ -464,12 +832,55 @@ scmf_rna_opt_data_set_scales (float neg, float het, Scmf_Rna_Opt_data* cedat)
 
    cedat->neg_scale = neg;
    cedat->het_scale = het;
+   SCMF_SYNC_WORKERS (cedat);
 }
 
 void
 scmf_rna_opt_data_set_het_window (const long size, Scmf_Rna_Opt_data* cedat)
 {
    cedat->win = size;
+   SCMF_SYNC_WORKERS (cedat);
+}
+
+/** @brief Set the maximum span of unwanted pairs in the negative design term.
+ *
+ * With a span of 0, the negative design term of the NN model approximates
+ * unwanted stacked pairs over the whole sequence. Otherwise, all unwanted
+ * stacked pairs (i, j) with j - i not above the span are counted exactly.
+ * Use SCMF_RNA_OPT_NEG_SPAN_ALL to count all unwanted pairs.
+ *
+ * @params[in] span Maximum span, 0 for the approximation.
+ * @params[in] cedat Data object.
+ */
+void
+scmf_rna_opt_data_set_neg_span (const unsigned long span,
+                                Scmf_Rna_Opt_data* cedat)
+{
+   assert (cedat);
+
+   cedat->neg_span = span;
+   SCMF_SYNC_WORKERS (cedat);
+}
+
+/** @brief Set the tolerance for changes of structure elements.
+ *
+ * Elements of the NN model are only recalculated once the columns they
+ * touch changed by more than the tolerance since they were last calculated.
+ * The change of an element is the sum over steps of the largest change of a
+ * probability in its columns. With a tolerance of 0, each element touching a
+ * column which changed at all is recalculated.
+ *
+ * @params[in] tolerance Max. change of an element before it is recalculated.
+ * @params[in] cedat Data object.
+ */
+void
+scmf_rna_opt_data_set_dirty_tolerance (const float tolerance,
+                                       Scmf_Rna_Opt_data* cedat)
+{
+   assert (cedat);
+   assert (tolerance >= 0.0f);
+
+   cedat->dirty_tol = tolerance;
 }
 
 void
@@ -479,6 +890,7 @@ scmf_rna_opt_data_set_bp_allowed (char** bp_allowed,
    assert (cedat);
 
    cedat->bp_allowed = bp_allowed;
+   SCMF_SYNC_WORKERS (cedat);
 }
 
 int
@@ -508,13 +920,87 @@ scmf_rna_opt_data_get_alphabet (Scmf_Rna_Opt_data* cont)
    return cont->sigma;
 }
 
+/** @brief Prepare the column aggregates for the nussinov model.
+ *
+ * To be registered as pre column iteration hook for the nussinov model. The
+ * negative design and heterogenity terms of @c scmf_rna_opt_calc_nussinov
+ * sum over all columns but the current one and its partner. Per step and
+ * state, these sums are computed as prefix sums of
+ * @c P(i,j)*scores[i][row] for columns left of the current one, suffix sums
+ * of @c P(i,j)*scores[row][i] for columns right of it and the same for the
+ * distance weighted probabilities of the heterogenity term.\n
+ * Returns 0.
+ *
+ * @params[in] data Data object.
+ * @params[in] sm Sequence matrix.
+ */
+int
+scmf_rna_opt_data_init_nussinov_aggregates (void* data, SeqMatrix* sm)
+{
+   Scmf_Rna_Opt_data* this;
+   unsigned long row, i, j;
+   unsigned long rows, cols;
+   float** scores;
+   float* a_suf;                  /* right of j, j pairs downstream */
+   float* b_pre;                  /* left of j, j pairs upstream */
+   float a, b;
+
+   assert (data);
+   assert (sm);
+
+   this = (Scmf_Rna_Opt_data*) data;
+   scores = (float**) this->scores;
+   rows = seqmatrix_get_rows (sm);
+   cols = seqmatrix_get_width (sm);
+
+   assert (this->col_agg);
+   assert (rows <= alphabet_size (this->sigma));
+   assert (cols <= rna_get_size (this->rna));
+
+   for (row = 0; row < rows; row++)
+   {
+      a_suf = this->col_agg[row];
+      b_pre = this->col_agg[rows + row];
+
+      /* left to right */
+      b_pre[0] = 0.0f;
+      for (j = 1; j < cols; j++)
+      {
+         b = 0.0f;
+         for (i = 0; i < rows; i++)
+         {
+            b += (seqmatrix_get_probability (i, j - 1, sm) * scores[i][row]);
+         }
+         b_pre[j] = b_pre[j - 1] + b;
+      }
+
+      /* right to left */
+      a_suf[cols - 1] = 0.0f;
+      for (j = cols - 1; j > 0; j--)
+      {
+         a = 0.0f;
+         for (i = 0; i < rows; i++)
+         {
+            a += (seqmatrix_get_probability (i, j, sm) * scores[row][i]);
+         }
+         a_suf[j - 1] = a_suf[j] + a;
+      }
+   }
+
+   scmf_rna_opt_calc_het_aggregates (rows, cols, this, sm);
+
+   return 0;
+}
+
 /** @brief calculate energy using the nussinov model.
  *
  * Calculate the energy for a cell of a sequence matrix using the nussinov
  * energy model. Supposed to be placed in the inner most loop.
  * The energy has mainly three terms: Interaction energy (actually no. of
  * Hbonds), negative design energy (negative interaction energy to all possible
- * partners) and a heterogenity term.\n
+ * partners) and a heterogenity term. The latter two are taken from the
+ * aggregates of @c scmf_rna_opt_data_init_nussinov_aggregates, which has to be
+ * run before each step.\n
  * Returns the energy value for the cell.
  *
  * @params[in] row Current row.
@@ -530,12 +1016,13 @@ scmf_rna_opt_calc_nussinov (const unsigned long row,
 {
    float cell = 0.0f;             /* cell to be calculated */
    unsigned long interaction;     /* col of cell interacts with col of sm */
-   unsigned long i, j;            /* indices */
+   unsigned long i;               /* index */
    unsigned long rows;            /* no. of rows of the matrix */
    unsigned long cols;            /* no. of cols of the matrix */
    float tmp_neg = 0.0f;          /* tmp for negative design term */
    float tmp_het = 0.0f;          /* tmp for heterogenity energy */
    float het_count = 0.0f;        /* heterogenity normalisation factor */
+   float weight;
    float** scores;
    Scmf_Rna_Opt_data* test;
 
@@ -550,6 +1037,13 @@ scmf_rna_opt_calc_nussinov (const unsigned long row,
    rows = seqmatrix_get_rows (sm);
    cols = seqmatrix_get_width (sm);
 
+   /* unwanted pairs with all other columns */
+   tmp_neg = test->col_agg[row][col] + test->col_agg[rows + row][col];
+   tmp_het = test->col_agg[(2 * rows) + row][col]
+      + test->col_agg[(3 * rows) + row][col];
+   het_count = test->col_agg[4 * rows][col]
+      + test->col_agg[(4 * rows) + 1][col];
+
    /* calculate contribution of wanted interaction (if any) */
    /* interaction = seqmatrix_col_interacts_with (col, sm);*/
    interaction = rna_base_pairs_with (col, test->rna);
@@ -568,41 +1062,13 @@ scmf_rna_opt_calc_nussinov (const unsigned long row,
                      * scores[i][row]);
          }
       }
-   }
 
-   /* calculate contribution of unwanted pairs */
-   for (j = 0; j < cols; j++)
-   {
-      if ((j != col) && (j != interaction))
-      {
-         for (i = 0; i < rows; i++)
-         {
-            if (col < j)
-            {
-               tmp_neg += (seqmatrix_get_probability (i, j, sm) 
-                           * scores[row][i]);
-            }
-            else
-            {
-               tmp_neg += (seqmatrix_get_probability (i, j, sm) 
-                           * scores[i][row]);
-            }
-         }
-            
-         /* heterogenity term */
-         if (col > j)
-         {
-            tmp_het += (seqmatrix_get_probability (row, j, sm)
-                        * expf(test->het_rate * (col - (j+1))));
-            het_count += expf ( (test->het_rate* (col - (j+1))));
-         }
-         else
-         {
-            tmp_het += (seqmatrix_get_probability (row, j, sm)
-                        * expf(test->het_rate * (j - (col+1))));
-            het_count += (expf (test->het_rate * (j - (col+1))));
-         }
-      }
+      /* the partner does not count as unwanted pair */
+      tmp_neg -= cell;
+
+      weight = scmf_rna_opt_het_weight (col, interaction, test);
+      tmp_het -= (seqmatrix_get_probability (row, interaction, sm) * weight);
+      het_count -= weight;
    }
 
    tmp_neg = (tmp_neg / cols) * (-1.25f); /* 1.25 */
@@ -641,6 +1107,14 @@ scmf_rna_opt_data_get_rna_size (Scmf_Rna_Opt_data* this)
    return rna_get_size (this->rna);
 }
 
+Rna*
+scmf_rna_opt_data_get_rna (Scmf_Rna_Opt_data* this)
+{
+   assert (this);
+
+   return this->rna;
+}
+
 /** @brief calculate energy using the Nearest Neighbour energy model.
  *
  * Calculate the energy for a cell of a sequence matrix using the Nearest
@@ -672,7 +1146,6 @@ scmf_rna_opt_calc_simplenn (const unsigned long row,
    float update_prob;             /* probability component for cell energy */
    float tmp_neg = 0.0f;          /* negative interaction term */
    float tmp_het = 0.0f;          /* heterogenity term */
-   float het_count = 0.0f;
    Scmf_Rna_Opt_data* cedat;
 /*    long tmp; */
 /*    long tmp4; */
@@ -804,33 +1277,15 @@ scmf_rna_opt_calc_simplenn (const unsigned long row,
    }
 
    /* SB NEW! 08-09-10 */
-   /* get neg.energy for current row n' col */
-   tmp_neg = 0;
-   /* SB: Cleanup 08-09-12 */
-   if (col > 0)
+   /* get neg.energy for current row n' col, prepared by
+      scmf_rna_opt_data_init_negative_design_energies_alt */
+   tmp_neg = cedat->col_agg[row][col];
+
+   /* care about interactions */
+   /* interacts with downstream position */
+   if ((interaction != NOT_PAIRED) && (col < interaction))
    {
-      /* handle neg.interactions upstream */
-      for (k = 0; k < alpha_size; k++)
-      {
-         tmp_neg += (  cedat->en_neg_35[row][k]
-                       * seqmatrix_get_probability (k, (col - 1), sm));
-      }
-   }
-   if ((col + 1) < cols)
-   {
-      /* handle downstream interactions */
-      for (k = 0; k < alpha_size; k++)
-      {
-         tmp_neg += (  cedat->en_neg2[row][k]
-                       * seqmatrix_get_probability (k, (col + 1), sm));
-      }      
-   }
-
-   /* care about interactions */
-   /* interacts with downstream position */
-   if ((interaction != NOT_PAIRED) && (col < interaction))
-   {
-      for (l = 0; cedat->bp_allowed[row][l] != 0; l++)
+      for (l = 0; cedat->bp_allowed[row][l] != 0; l++)
       {
          bj = (char)(cedat->bp_allowed[row][l] - 1);
          
@@ -875,83 +1330,15 @@ scmf_rna_opt_calc_simplenn (const unsigned long row,
          }
       }
    }   
-   /* SB: 08-09-12 */
-   scmf_rna_opt_iterate_neg_design_term (row, col, cedat, sm);
-
    /* SB END - 08-09-10 */
 
-
-   /* calculate contribution of unwanted pairs */
-   /*tmp = 0; tmp2 = 0.0f; tmp3 = 0.0f; */
-   for (k = 0; k < cols; k++)
+   /* heterogenity term over all but the current site and its partner */
+   tmp_het = cedat->col_agg[(2 * alpha_size) + row][col]
+      + cedat->col_agg[(3 * alpha_size) + row][col];
+   if (interaction != NOT_PAIRED)
    {
-      if ((k != col) && (k != interaction))
-      {
-/*SNIP*/
-/*          if (col < k) /\* col is i, k is j (base pair is i < j) *\/ */
-/*          { */
-/*             /\* we only consider allowed base pairs *\/ */
-/*             /\* tmp = 0; *\/ */
-/*             for (l = 0; cedat->bp_allowed[row][l] != 0; l++) */
-/*             { */
-/*                bj = cedat->bp_allowed[row][l] - 1; */
-
-/*                for (m = 0; m < allowed_bp; m++) */
-/*                { */
-/*                   nn_scores_get_allowed_basepair (m, &bip1, &bjm1, */
-/*                                                   cedat->scores); */
-                  
-/*                   update_prob = */
-/*                      seqmatrix_get_probability (bj, k, sm) */
-/*                      * seqmatrix_get_probability (bip1, (col + 1), sm) */
-/*                      * seqmatrix_get_probability (bjm1, (k - 1), sm); */
-                  
-/*                   tmp_neg += (nn_scores_get_G_stack (row, bj, bjm1, bip1, */
-/*                                                      cedat->scores) */
-/*                               * update_prob); */
-/*                } */
-/*             } */
-/*             /\* mfprintf (stdout, "y: %.2f ", tmp2); *\/ */
-/*          } */
-/*          else         /\* k is i, col is j *\/ */
-/*          { */
-/*             /\* we only consider allowed base pairs *\/ */
-/*             for (l = 0; cedat->bp_allowed[row][l] != 0; l++) */
-/*             { */
-/*                bi = cedat->bp_allowed[row][l] - 1; */
-/*                for (m = 0; m < allowed_bp; m++) */
-/*                { */
-/*                   nn_scores_get_allowed_basepair (m, &bip1, &bjm1, */
-/*                                                   cedat->scores); */
-                  
-/*                   update_prob = */
-/*                      seqmatrix_get_probability (bi, k, sm) */
-/*                      * seqmatrix_get_probability (bip1, (k + 1), sm) */
-/*                      * seqmatrix_get_probability (bjm1, (col - 1), sm); */
-                  
-/*                   tmp_neg += (nn_scores_get_G_stack (bi, row, bjm1, bip1, */
-/*                                                      cedat->scores) */
-/*                               * update_prob); */
-
-/*                } */
-/*             } */
-/*             /\* mfprintf (stdout, "x: %.2f ", tmp2); *\/ */
-/*          } */
-/*SNIP*/
-         /* heterogenity term */
-         if (col > k)
-         {
-            tmp_het += (seqmatrix_get_probability (row, k, sm)
-                        * expf(cedat->het_rate * (col - (k+1))));
-            het_count += expf ( (cedat->het_rate* (col - (k+1))));
-         }
-         else
-         {
-            tmp_het += (seqmatrix_get_probability (row, k, sm)
-                        * expf(cedat->het_rate * (k - (col+1))));
-            het_count += (expf (cedat->het_rate * (k - (col+1))));
-         }         
-      }
+      tmp_het -= (seqmatrix_get_probability (row, interaction, sm)
+                  * scmf_rna_opt_het_weight (col, interaction, cedat));
    }
 
    /*mfprintf (stderr, "c: %lu r: %lu Eneg: %.2f cell: %.2f\n",
@@ -970,6 +1357,30 @@ scmf_rna_opt_calc_simplenn (const unsigned long row,
 
 /* RNA design using the full NN model.
 */
+
+/* Store a contribution of the structure element under evaluation. Cached
+   contributions are added to the Eeff matrix by scmf_rna_opt_calc_col_nn(). */
+static __inline__ void
+scmf_rna_opt_add_2_eeff (const float value,
+                         const unsigned long row,
+                         const unsigned long col,
+                         Scmf_Rna_Opt_data* this)
+{
+   EeffCell cell;
+
+   assert (this->rec);
+
+   cell.row   = row;
+   cell.col   = col;
+   cell.value = value;
+
+   ARRAY_PUSH (this->rec[0], cell, EeffCell,
+               {
+                  this->rec_error = 1;
+                  return;
+               });
+}
+
 static void
 scmf_rna_opt_calc_hairpin (const unsigned long row,
                            const unsigned long hairpin,
@@ -981,10 +1392,8 @@ scmf_rna_opt_calc_hairpin (const unsigned long row,
    unsigned long start, end, size;
    char bpp, bi, bj; /* base pair partner */
    unsigned long k, l, m;
-   unsigned long n_tetra_loops;
    float cell5p, cell3p;
    float update_prob5p, update_prob3p;
-   const char* t_loop;
 
    secstruct_get_geometry_hairpin(&start, &end, &size, hairpin,
                                   rna_get_secstruct(this->rna));
@@ -1029,8 +1438,8 @@ scmf_rna_opt_calc_hairpin (const unsigned long row,
    /* 4 bases make one mismatch/ closing bp */
    cell5p = cell5p / 4; /* SB 08-12-12 */
    cell3p = cell3p / 4; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell5p, row, start, sm);
-   seqmatrix_add_2_eeff (cell3p, row,   end, sm);
+   scmf_rna_opt_add_2_eeff (cell5p, row, start, this);
+   scmf_rna_opt_add_2_eeff (cell3p, row,   end, this);
 
    /* process opening "base pair" (i+1, j-1) */
    cell5p = 0.0f;
@@ -1058,44 +1467,79 @@ scmf_rna_opt_calc_hairpin (const unsigned long row,
    /* 4 bases make one mismatch/ closing bp */
    cell5p = cell5p / 4; /* SB 08-12-12 */
    cell3p = cell3p / 4; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell5p, row, start + 1, sm);
-   seqmatrix_add_2_eeff (cell3p, row, end - 1  , sm);
+   scmf_rna_opt_add_2_eeff (cell5p, row, start + 1, this);
+   scmf_rna_opt_add_2_eeff (cell3p, row, end - 1  , this);
+}
 
-   /* modeling tetraloops */
-   if (size == nn_scores_get_size_tetra_loop(this->scores))
+/* Tetraloop bonus energies are distributed over the 6 bases of a hairpin of
+   size 4 and its closing base pair. For each candidate loop, each cell of the
+   loop gets the bonus weighted by the probability of the other 5 bases. Loops
+   where even the 5 most probable bases stay below SCMF_TL_EPSILON are
+   skipped. */
+static void
+scmf_rna_opt_calc_tetra_loop (const unsigned long hairpin,
+                              SeqMatrix* sm,
+                              Scmf_Rna_Opt_data* this)
+{
+   unsigned long start, end, size;
+   unsigned long k, l, m;
+   unsigned long n_tetra_loops;
+   float p, p_min, p_rest, bonus;
+   const char* t_loop;
+
+   secstruct_get_geometry_hairpin(&start, &end, &size, hairpin,
+                                  rna_get_secstruct(this->rna));
+
+   if (size != nn_scores_get_size_tetra_loop(this->scores))
    {
-      size = nn_scores_get_size_tetra_loop_full(this->scores);
-      /* loop over all tetraloops */
-      n_tetra_loops = nn_scores_get_no_of_tetra_loops (this->scores);
-      for (k = 0; k < n_tetra_loops; k++)
-      {
-         /* fetch current loop */
-         t_loop = nn_scores_get_tetra_loop (k, this->scores);
-         update_prob5p = 1.0;
+      return;
+   }
+
+   size = nn_scores_get_size_tetra_loop_full(this->scores);
+   /* loop over all tetraloops */
+   n_tetra_loops = nn_scores_get_no_of_tetra_loops (this->scores);
+   for (k = 0; k < n_tetra_loops; k++)
+   {
+      /* fetch current loop */
+      t_loop = nn_scores_get_tetra_loop (k, this->scores);
 
-         /* calc eeff on base of ALL involved bases 
-            this is the loop size and its closing bp */
-         for (l = 0; l < size; l++)
+      /* joint probability of the loop without its least likely base */
+      p_min = 1.0f;
+      p_rest = 1.0f;
+      for (l = 0; l < size; l++)
+      {
+         p = seqmatrix_get_probability(t_loop[l], start + l, sm);
+         if (p < p_min)
+         {
+            p_rest *= p_min;
+            p_min = p;
+         }
+         else
          {
-            update_prob5p *= seqmatrix_get_probability(t_loop[l],
-                                                       start + l,
-                                                       sm);
+            p_rest *= p;
          }
-         /* tetra loop score is for whole loop, so we spread the value */
-         cell5p = update_prob5p *
-            nn_scores_get_G_tetra_loop (t_loop, 0,this->scores) / size;
+      }
+
+      if (p_rest < SCMF_TL_EPSILON)
+      {
+         continue;
+      }
 
-         /* add eeff to matching cells */
-         for (l = 0; l < size; l++)
+      /* tetra loop score is for whole loop, so we spread the value */
+      bonus = nn_scores_get_G_tetra_loop (t_loop, 0,this->scores) / size;
+
+      /* add eeff to matching cells */
+      for (l = 0; l < size; l++)
+      {
+         p = bonus;
+         for (m = 0; m < size; m++)
          {
-            if ((unsigned) t_loop[l] == row)
+            if (m != l)
             {
-               cell3p = cell5p / seqmatrix_get_probability(t_loop[l],
-                                                           start + l,
-                                                           sm);
-               seqmatrix_add_2_eeff (cell3p, row, start + l, sm);
+               p *= seqmatrix_get_probability(t_loop[m], start + m, sm);
             }
-         }         
+         }
+         scmf_rna_opt_add_2_eeff (p, (unsigned long) t_loop[l], start + l, this);
       }
    }
 }
@@ -1146,8 +1590,8 @@ scmf_rna_opt_calc_ext_loop (const unsigned long row,
          spread it over the involved bases */
       cell5p = cell5p / 2; /* SB 08-12-11 */
       cell3p = cell3p / 2; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
    }
 
    /* 5' dangle */
@@ -1179,8 +1623,8 @@ scmf_rna_opt_calc_ext_loop (const unsigned long row,
       /* 3 bases are involved in 5p dangle */
       cell5p = cell5p / 3; /* SB 08-12-11 */
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
 
       /* design free base: for all allowed bp with free base 'row' */
       cell5p = 0.0f;
@@ -1194,7 +1638,7 @@ scmf_rna_opt_calc_ext_loop (const unsigned long row,
       }
       /* 3 bases are involved in 5p dangle */
       cell5p = cell5p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, fbpos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, fbpos, this);
    }
 
    /* 3' dangle */
@@ -1226,8 +1670,8 @@ scmf_rna_opt_calc_ext_loop (const unsigned long row,
       /* 3 bases are involved in 3p dangle */
       cell5p = cell5p / 3; /* SB 08-12-11 */
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
 
       /* design free base: for all allowed bp with free base 'row' */
       cell3p = 0.0f;
@@ -1241,7 +1685,7 @@ scmf_rna_opt_calc_ext_loop (const unsigned long row,
       }
       /* 3 bases are involved in 3p dangle */
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell3p, row, fbpos, sm);
+      scmf_rna_opt_add_2_eeff (cell3p, row, fbpos, this);
    }
 }
 
@@ -1288,8 +1732,8 @@ scmf_rna_opt_calc_multi_loop (const unsigned long row,
          spread it over the involved bases */
       cell5p = cell5p / 2; /* SB 08-12-11 */
       cell3p = cell3p / 2; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
    }
 
    /* 5' dangle */
@@ -1321,8 +1765,8 @@ scmf_rna_opt_calc_multi_loop (const unsigned long row,
       /* all 3 bases get equal contribution */
       cell5p = cell5p / 3; /* SB 08-12-11 */
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
 
       /* design free base: for all allowed bp with free base 'row' */
       cell5p = 0.0f;
@@ -1335,7 +1779,7 @@ scmf_rna_opt_calc_multi_loop (const unsigned long row,
                     * nn_scores_get_G_dangle5 (bi, bj, row, this->scores));
       }
       cell5p = cell5p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, fbpos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, fbpos, this);
    }
 
    /* 3' dangle */
@@ -1367,8 +1811,8 @@ scmf_rna_opt_calc_multi_loop (const unsigned long row,
       /* all 3 bases get equal contribution */
       cell5p = cell5p / 3; /* SB 08-12-11 */
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell5p, row, p5pos, sm);
-      seqmatrix_add_2_eeff (cell3p, row, p3pos, sm);
+      scmf_rna_opt_add_2_eeff (cell5p, row, p5pos, this);
+      scmf_rna_opt_add_2_eeff (cell3p, row, p3pos, this);
 
       /* design free base: for all allowed bp with free base 'row' */
       cell3p = 0.0f;
@@ -1390,7 +1834,7 @@ scmf_rna_opt_calc_multi_loop (const unsigned long row,
                   * seqmatrix_get_probability(bj, p3pos, sm)));*/
       }
       cell3p = cell3p / 3; /* SB 08-12-11 */
-      seqmatrix_add_2_eeff (cell3p, row, fbpos, sm);
+      scmf_rna_opt_add_2_eeff (cell3p, row, fbpos, this);
    }
 }
 
@@ -1461,10 +1905,10 @@ scmf_rna_opt_calc_bulge (const unsigned long row,
    cell_j1 = cell_j1 / 4; /* SB 08-12-12 */
    cell_i2 = cell_i2 / 4; /* SB 08-12-12 */
    cell_j2 = cell_j2 / 4; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, i1pos, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, j1pos, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, i2pos, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, j2pos, sm);
+   scmf_rna_opt_add_2_eeff (cell_i1, row, i1pos, this);
+   scmf_rna_opt_add_2_eeff (cell_j1, row, j1pos, this);
+   scmf_rna_opt_add_2_eeff (cell_i2, row, i2pos, this);
+   scmf_rna_opt_add_2_eeff (cell_j2, row, j2pos, this);
 }
 
 static void
@@ -1521,10 +1965,10 @@ scmf_rna_opt_calc_stack (const unsigned long row,
    cell_j   = cell_j   / 4; /* SB 08-12-12 */
    cell_ip1 = cell_ip1 / 4; /* SB 08-12-12 */
    cell_jm1 = cell_jm1 / 4; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i,   row, i,     sm);
-   seqmatrix_add_2_eeff (cell_j,   row, j,     sm);
-   seqmatrix_add_2_eeff (cell_ip1, row, i + 1, sm);
-   seqmatrix_add_2_eeff (cell_jm1, row, j - 1, sm);
+   scmf_rna_opt_add_2_eeff (cell_i,   row, i,     this);
+   scmf_rna_opt_add_2_eeff (cell_j,   row, j,     this);
+   scmf_rna_opt_add_2_eeff (cell_ip1, row, i + 1, this);
+   scmf_rna_opt_add_2_eeff (cell_jm1, row, j - 1, this);
 }
 
 static __inline__ void
@@ -1612,10 +2056,10 @@ scmf_rna_opt_calc_internal (const unsigned long row,
    cell_j1 = cell_j1 / 4;       /* SB 08-12-12 */
    cell_i2 = cell_i2 / 4;       /* SB 08-12-12 */
    cell_j2 = cell_j2 / 4;       /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2, sm);
+   scmf_rna_opt_add_2_eeff (cell_i1, row, pi1, this);
+   scmf_rna_opt_add_2_eeff (cell_j1, row, pj1, this);
+   scmf_rna_opt_add_2_eeff (cell_j2, row, pj2, this);
+   scmf_rna_opt_add_2_eeff (cell_i2, row, pi2, this);
 
    /* design unpaired bases */
    cell_i1 = 0.0f;
@@ -1680,15 +2124,80 @@ scmf_rna_opt_calc_internal (const unsigned long row,
    cell_j1 = cell_j1 / 4;       /* SB 08-12-12 */
    cell_i2 = cell_i2 / 4;       /* SB 08-12-12 */
    cell_j2 = cell_j2 / 4;       /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1 + 1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1 - 1, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2 + 1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2 - 1, sm);
+   scmf_rna_opt_add_2_eeff (cell_i1, row, pi1 + 1, this);
+   scmf_rna_opt_add_2_eeff (cell_j1, row, pj1 - 1, this);
+   scmf_rna_opt_add_2_eeff (cell_j2, row, pj2 + 1, this);
+   scmf_rna_opt_add_2_eeff (cell_i2, row, pi2 - 1, this);
 }
 
+/* Small internal loops (1x1, 1x2, 2x2) are designed by staged contractions:
+   Once per loop, the energy table is contracted against the probabilities of
+   the unpaired bases for each combination of closing base pairs and against
+   the closing base pairs for the unpaired sites. The resulting vectors are
+   then used to update the cells of all states. All buffers are taken from
+   the scratch space of the data object. */
+
 static __inline__ void
-scmf_rna_opt_calc_int22 (const unsigned long row,
-                         unsigned long allowed_bp,
+scmf_rna_opt_fetch_col_probs (float* vec,
+                              const unsigned long col,
+                              const unsigned long alpha_size,
+                              SeqMatrix* sm)
+{
+   unsigned long k;
+
+   for (k = 0; k < alpha_size; k++)
+   {
+      vec[k] = seqmatrix_get_probability (k, col, sm);
+   }
+}
+
+static void
+scmf_rna_opt_add_int_paired (const float* t_out,
+                             const float* t_in,
+                             const float div,
+                             unsigned long alpha_size,
+                             unsigned long pi1,
+                             unsigned long pj1,
+                             unsigned long pi2,
+                             unsigned long pj2,
+                             SeqMatrix* sm,
+                             Scmf_Rna_Opt_data* this)
+{
+   unsigned long k, row;
+   char bpp;
+   float cell_i1, cell_j1, cell_i2, cell_j2;
+
+   for (row = 0; row < alpha_size; row++)
+   {
+      cell_i1 = 0.0f;
+      cell_j1 = 0.0f;
+      cell_i2 = 0.0f;
+      cell_j2 = 0.0f;
+
+      /* for all allowed pairs */
+      for (k = 0; this->bp_allowed[row][k] != 0; k++)
+      {
+         bpp = (char) (this->bp_allowed[row][k] - 1);
+
+         cell_i1 += seqmatrix_get_probability(bpp, pj1, sm)
+            * t_in[nn_scores_bp_2_idx ((char) row, bpp, this->scores)];
+         cell_j1 += seqmatrix_get_probability(bpp, pi1, sm)
+            * t_in[nn_scores_bp_2_idx (bpp, (char) row, this->scores)];
+         cell_i2 += seqmatrix_get_probability(bpp, pj2, sm)
+            * t_out[nn_scores_bp_2_idx (bpp, (char) row, this->scores)];
+         cell_j2 += seqmatrix_get_probability(bpp, pi2, sm)
+            * t_out[nn_scores_bp_2_idx ((char) row, bpp, this->scores)];
+      }
+
+      scmf_rna_opt_add_2_eeff (cell_i1 / div, row, pi1, this);
+      scmf_rna_opt_add_2_eeff (cell_j1 / div, row, pj1, this);
+      scmf_rna_opt_add_2_eeff (cell_i2 / div, row, pi2, this);
+      scmf_rna_opt_add_2_eeff (cell_j2 / div, row, pj2, this);
+   }
+}
+
+static void
+scmf_rna_opt_calc_int22 (unsigned long allowed_bp,
                          unsigned long alpha_size,
                          unsigned long pi1,
                          unsigned long pj1,
@@ -1697,215 +2206,168 @@ scmf_rna_opt_calc_int22 (const unsigned long row,
                          SeqMatrix* sm,
                          Scmf_Rna_Opt_data* this)
 {
-   unsigned long k, l, m, n, o, p;
-   char bpp, bi, bj, bi2, bj2;
-   float pr, p_bi1pi2m, p_bj2p, p_bp1, p_bp2;
-   float cell_i1, cell_j1, cell_i2, cell_j2;
+   unsigned long k, l, m, n, o, p, x, n_tuples;
+   char bi, bj, bi2, bj2;
+   float p_bp1, p_bp2, p_bb, p_mn, p_mno, g, c;
+   char* tuples;                /* loops of one pair of closing pairs */
+   float* g_cell;               /* their energies */
+   float* t_out;                /* contracted over all but the outer pair */
+   float* t_in;                 /* contracted over all but the inner pair */
+   float* p_i1p;                /* probabilities of the unpaired bases */
+   float* p_i2m;
+   float* p_j2p;
+   float* p_j1m;
+   float* u_i1p;                /* energies of the unpaired sites */
+   float* u_i2m;
+   float* u_j2p;
+   float* u_j1m;
+   float* g_bar;                /* loop table summed over closing pairs */
+
+   t_out = this->int_scratch;
+   t_in  = t_out + allowed_bp;
+   p_i1p = t_in  + allowed_bp;
+   p_i2m = p_i1p + alpha_size;
+   p_j2p = p_i2m + alpha_size;
+   p_j1m = p_j2p + alpha_size;
+   u_i1p = p_j1m + alpha_size;
+   u_i2m = u_i1p + alpha_size;
+   u_j2p = u_i2m + alpha_size;
+   u_j1m = u_j2p + alpha_size;
+   g_bar = u_j1m + alpha_size;
+   n_tuples = alpha_size * alpha_size * alpha_size * alpha_size;
+   g_cell = g_bar + n_tuples;
+   tuples = (char*) (g_cell + n_tuples);
+
+   scmf_rna_opt_fetch_col_probs (p_i1p, pi1 + 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_i2m, pi2 - 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_j2p, pj2 + 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_j1m, pj1 - 1, alpha_size, sm);
 
-   /*mfprintf (stderr,"i1: %lu, j1: %lu, i2: %lu, j2: %lu\n", i1, j1, i2, j2);*/
+   for (k = 0; k < allowed_bp; k++)
+   {
+      t_out[k] = 0.0f;
+      t_in[k] = 0.0f;
+   }
+   for (k = 0; k < alpha_size; k++)
+   {
+      u_i1p[k] = 0.0f;
+      u_i2m[k] = 0.0f;
+      u_j2p[k] = 0.0f;
+      u_j1m[k] = 0.0f;
+   }
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
+   {
+      for (n = 0; n < alpha_size; n++)
+      {
+         for (o = 0; o < alpha_size; o++)
+         {
+            for (p = 0; p < alpha_size; p++)
+            {
+               g_bar[x] = 0.0f;
+               /* unpaired bases of the loop tuples stay fixed */
+               tuples[(x * 8) + 2] = (char) m;
+               tuples[(x * 8) + 3] = (char) n;
+               tuples[(x * 8) + 6] = (char) o;
+               tuples[(x * 8) + 7] = (char) p;
+               x++;
+            }
+         }
+      }
+   }
 
-   /* design paired bases */
-   cell_i1 = 0.0f;
-   cell_j1 = 0.0f;
-   cell_i2 = 0.0f;
-   cell_j2 = 0.0f;
-   /* for all allowed pairs */
-   for (k = 0; this->bp_allowed[row][k] != 0; k++)
+   /* contract the 2x2 table for all combinations of closing pairs */
+   for (k = 0; k < allowed_bp; k++)
    {
-      bpp = (char) (this->bp_allowed[row][k] - 1);
+      /* outer pair (i1, j1) */
+      nn_scores_get_allowed_basepair (k, &bi, &bj, this->scores);
+
+      p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
+         * seqmatrix_get_probability(bj, pj1, sm);
 
-      /* for all possible pairs */
       for (l = 0; l < allowed_bp; l++)
       {
-         nn_scores_get_allowed_basepair (l, &bi2, &bj2, this->scores);
+         /* inner pair (j2, i2) */
+         nn_scores_get_allowed_basepair (l, &bj2, &bi2, this->scores);
 
          p_bp2 = seqmatrix_get_probability(bj2, pj2, sm)
             * seqmatrix_get_probability(bi2, pi2, sm);
+         p_bb = p_bp1 * p_bp2;
 
-         p_bp1 = seqmatrix_get_probability(bi2, pi1, sm)
-            * seqmatrix_get_probability(bj2, pj1, sm);
+         /* fetch the whole table for this pair of closing pairs at once */
+         for (x = 0; x < n_tuples; x++)
+         {
+            tuples[(x * 8) + 0] = bi;
+            tuples[(x * 8) + 1] = bj;
+            tuples[(x * 8) + 4] = bj2;
+            tuples[(x * 8) + 5] = bi2;
+         }
+         nn_scores_get_G_internal_2x2_loop_n (tuples, n_tuples, g_cell,
+                                              this->scores);
 
-         /* for all bases */
+         c = 0.0f;
+         x = 0;
          for (m = 0; m < alpha_size; m++)
          {
-            /* for all bases */
             for (n = 0; n < alpha_size; n++)
             {
-               p_bi1pi2m = seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pi2 - 1, sm);
+               p_mn = p_i1p[m] * p_i2m[n];
 
-               /* for all bases */
                for (o = 0; o < alpha_size; o++)
                {
-                  p_bj2p = p_bi1pi2m * seqmatrix_get_probability(o, pj2 + 1, sm);
+                  p_mno = p_mn * p_j2p[o];
 
-                  /* for all bases */
                   for (p = 0; p < alpha_size; p++)
                   {
-                     /* i1 */
-                     pr =p_bj2p * p_bp2
-                        * seqmatrix_get_probability(p, pj1 - 1, sm)
-                        * seqmatrix_get_probability(bpp, pj1, sm);
-
-                     cell_i1 += pr *
-                        nn_scores_get_G_internal_2x2_loop (row, bpp,
-                                                           m, n,
-                                                           bj2, bi2,
-                                                           o, p,
-                                                           this->scores);
-
-                     /* j1 */
-                     pr = p_bj2p * p_bp2
-                        * seqmatrix_get_probability(p, pj1 - 1, sm)
-                        * seqmatrix_get_probability(bpp, pi1, sm);
-
-                     cell_j1 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bpp, row,
-                                                           m, n,
-                                                           bj2, bi2,
-                                                           o, p,
-                                                           this->scores);
-
-                     /* i2 */
-                     pr = p_bj2p * p_bp1
-                        * seqmatrix_get_probability(p, pj1 - 1, sm)
-                        * seqmatrix_get_probability(bpp, pj2, sm);
-
-                     cell_i2 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi2, bj2,
-                                                           m, n,
-                                                           bpp, row,
-                                                           o, p,
-                                                           this->scores);
-
-                     /* j2 */
-                     pr = p_bj2p *  p_bp1
-                        * seqmatrix_get_probability(p, pj1 - 1, sm)
-                        * seqmatrix_get_probability(bpp, pi2, sm);
-
-                     cell_j2 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi2, bj2,
-                                                           m, n,
-                                                           row, bpp,
-                                                           o, p,
-                                                           this->scores);
-
+                     g = g_cell[x];
+                     c += p_mno * p_j1m[p] * g;
+                     g_bar[x] += p_bb * g;
+                     x++;
                   }
                }
             }
          }
+
+         t_in[k]  += p_bp2 * c;
+         t_out[l] += p_bp1 * c;
       }
    }
-   /* 8 bases are involved in a 2x2 loop */
-   cell_i1 = cell_i1 / 8; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 8; /* SB 08-12-12 */
-   cell_i2 = cell_i2 / 8; /* SB 08-12-12 */
-   cell_j2 = cell_j2 / 8; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2, sm);
 
-   /* design unpaired bases */
-   cell_i1 = 0.0f;
-   cell_i2 = 0.0f;
-   cell_j2 = 0.0f;
-   cell_j1 = 0.0f;
-   /* for all possible pairs */
-   for (k = 0; k < allowed_bp; k++)
+   /* contract the pair summed table for each unpaired site */
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
    {
-      nn_scores_get_allowed_basepair (k, &bi, &bj, this->scores);
-
-      p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
-         * seqmatrix_get_probability(bj, pj1, sm);
-
-      /* for all possible pairs */
-      for (l = 0; l < allowed_bp; l++)
+      for (n = 0; n < alpha_size; n++)
       {
-         nn_scores_get_allowed_basepair (l, &bi2, &bj2, this->scores);
-
-         p_bp2 =  seqmatrix_get_probability(bj2, pj2, sm)
-            * seqmatrix_get_probability(bi2, pi2, sm);
-
-         /* for all bases */
-         for (m = 0; m < alpha_size; m++)
+         for (o = 0; o < alpha_size; o++)
          {
-            /* for all bases */
-            for (n = 0; n < alpha_size; n++)
+            for (p = 0; p < alpha_size; p++)
             {
-               /* for all bases */
-               for (o = 0; o < alpha_size; o++)
-               {
-                  /* i1 + 1 */
-                  pr = p_bp1 * p_bp2
-                     * seqmatrix_get_probability(m, pi2 - 1, sm)
-                     * seqmatrix_get_probability(n, pj2 + 1, sm)
-                     * seqmatrix_get_probability(o, pj1 - 1, sm);
-
-                  cell_i1 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi, bj,
-                                                           row, m,
-                                                           bj2, bi2,
-                                                           n, o,
-                                                           this->scores);
-
-                  /* i2 - 1 */
-                  pr = p_bp1 * p_bp2
-                     * seqmatrix_get_probability(m, pi1 + 1, sm)
-                     * seqmatrix_get_probability(n, pj2 + 1, sm)
-                     * seqmatrix_get_probability(o, pj1 - 1, sm);
-
-                  cell_i2 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi, bj,
-                                                           m, row,
-                                                           bj2, bi2,
-                                                           n, o,
-                                                           this->scores);
-
-                  /* j2 + 1 */
-                  pr = p_bp1 * p_bp2
-                     * seqmatrix_get_probability(m, pi1 + 1, sm)
-                     * seqmatrix_get_probability(n, pi2 - 1, sm)
-                     * seqmatrix_get_probability(o, pj1 - 1, sm);
-
-                  cell_j2 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi, bj,
-                                                           m, n,
-                                                           bj2, bi2,
-                                                           row, o,
-                                                           this->scores);
-
-                  /* j1 - 1 */
-                  pr = p_bp1 * p_bp2
-                     * seqmatrix_get_probability(m, pi1 + 1, sm)
-                     * seqmatrix_get_probability(n, pi2 - 1, sm)
-                     * seqmatrix_get_probability(o, pj2 + 1, sm);
-                  
-                  cell_j1 += pr *
-                        nn_scores_get_G_internal_2x2_loop (bi, bj,
-                                                           m, n,
-                                                           bj2, bi2,
-                                                           o, row,
-                                                           this->scores);
-               }
+               g = g_bar[x];
+               u_i1p[m] += g * p_i2m[n] * p_j2p[o] * p_j1m[p];
+               u_i2m[n] += g * p_i1p[m] * p_j2p[o] * p_j1m[p];
+               u_j2p[o] += g * p_i1p[m] * p_i2m[n] * p_j1m[p];
+               u_j1m[p] += g * p_i1p[m] * p_i2m[n] * p_j2p[o];
+               x++;
             }
          }
       }
    }
+
    /* 8 bases are involved in a 2x2 loop */
-   cell_i1 = cell_i1 / 8; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 8; /* SB 08-12-12 */
-   cell_i2 = cell_i2 / 8; /* SB 08-12-12 */
-   cell_j2 = cell_j2 / 8; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1 + 1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2 - 1, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2 + 1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1 - 1, sm);
+   scmf_rna_opt_add_int_paired (t_out, t_in, 8.0f, alpha_size,
+                                pi1, pj1, pi2, pj2, sm, this);
+   for (k = 0; k < alpha_size; k++)
+   {
+      scmf_rna_opt_add_2_eeff (u_i1p[k] / 8, k, pi1 + 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_i2m[k] / 8, k, pi2 - 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_j2p[k] / 8, k, pj2 + 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_j1m[k] / 8, k, pj1 - 1, this); /* SB 08-12-12 */
+   }
 }
 
 static void
-scmf_rna_opt_calc_int12 (const unsigned long row,
-                         unsigned long allowed_bp,
+scmf_rna_opt_calc_int12 (unsigned long allowed_bp,
                          unsigned long alpha_size,
                          unsigned long pi1,
                          unsigned long pj1,
@@ -1914,345 +2376,275 @@ scmf_rna_opt_calc_int12 (const unsigned long row,
                          SeqMatrix* sm,
                          Scmf_Rna_Opt_data* this)
 {
-   unsigned long k, l, m, n, o;
-   char bpp, bi, bj, bi2, bj2;
-   float p, p_bp2, p_bp1, p_bb;
-   float cell_i1, cell_j1, cell_i2, cell_j2;
+   unsigned long k, l, m, n, o, x, n_tuples;
+   char bi, bj, bi2, bj2;
+   float p_bp1, p_bp2, p_bb, p_mn, g, c;
+   char* tuples;                /* loops of one pair of closing pairs */
+   float* g_cell;               /* their energies */
+   float* t_out;                /* contracted over all but the outer pair */
+   float* t_in;                 /* contracted over all but the inner pair */
+   float* p_i1p;                /* probabilities of the unpaired bases */
+   float* p_j2p;
+   float* p_j1m;
+   float* u_i1p;                /* energies of the unpaired sites */
+   float* u_j2p;
+   float* u_j1m;
+   float* g_bar;                /* loop table summed over closing pairs */
+
+   t_out = this->int_scratch;
+   t_in  = t_out + allowed_bp;
+   p_i1p = t_in  + allowed_bp;
+   p_j2p = p_i1p + alpha_size;
+   p_j1m = p_j2p + alpha_size;
+   u_i1p = p_j1m + alpha_size;
+   u_j2p = u_i1p + alpha_size;
+   u_j1m = u_j2p + alpha_size;
+   g_bar = u_j1m + alpha_size;
+   n_tuples = alpha_size * alpha_size * alpha_size;
+   g_cell = g_bar + n_tuples;
+   tuples = (char*) (g_cell + n_tuples);
+
+   scmf_rna_opt_fetch_col_probs (p_i1p, pi1 + 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_j2p, pj2 + 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_j1m, pj1 - 1, alpha_size, sm);
 
+   for (k = 0; k < allowed_bp; k++)
+   {
+      t_out[k] = 0.0f;
+      t_in[k] = 0.0f;
+   }
+   for (k = 0; k < alpha_size; k++)
+   {
+      u_i1p[k] = 0.0f;
+      u_j2p[k] = 0.0f;
+      u_j1m[k] = 0.0f;
+   }
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
+   {
+      for (n = 0; n < alpha_size; n++)
+      {
+         for (o = 0; o < alpha_size; o++)
+         {
+            g_bar[x] = 0.0f;
+            /* unpaired bases of the loop tuples stay fixed */
+            tuples[(x * 7) + 2] = (char) m;
+            tuples[(x * 7) + 3] = (char) n;
+            tuples[(x * 7) + 4] = (char) o;
+            x++;
+         }
+      }
+   }
 
-   /* for all allowed pairs */
-   cell_i1 = 0.0f;
-   cell_j1 = 0.0f;
-   cell_i2 = 0.0f;
-   cell_j2 = 0.0f;
-   for (k = 0; this->bp_allowed[row][k] != 0; k++)
+   /* contract the 1x2 table for all combinations of closing pairs */
+   for (k = 0; k < allowed_bp; k++)
    {
-      bpp = (char) (this->bp_allowed[row][k] - 1);
+      /* outer pair (i1, j1) */
+      nn_scores_get_allowed_basepair (k, &bi, &bj, this->scores);
+
+      p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
+         * seqmatrix_get_probability(bj, pj1, sm);
 
-      /* for all possible pairs */
       for (l = 0; l < allowed_bp; l++)
       {
-         nn_scores_get_allowed_basepair (l, &bi, &bj, this->scores);
+         /* inner pair (j2, i2) */
+         nn_scores_get_allowed_basepair (l, &bj2, &bi2, this->scores);
 
-         p_bp2 = seqmatrix_get_probability(bi, pi2, sm)
-            * seqmatrix_get_probability(bj, pj2, sm);
+         p_bp2 = seqmatrix_get_probability(bj2, pj2, sm)
+            * seqmatrix_get_probability(bi2, pi2, sm);
+         p_bb = p_bp1 * p_bp2;
 
-         p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
-            * seqmatrix_get_probability(bj, pj1, sm);
+         /* fetch the whole table for this pair of closing pairs at once */
+         for (x = 0; x < n_tuples; x++)
+         {
+            tuples[(x * 7) + 0] = bi;
+            tuples[(x * 7) + 1] = bj;
+            tuples[(x * 7) + 5] = bj2;
+            tuples[(x * 7) + 6] = bi2;
+         }
+         nn_scores_get_G_internal_1x2_loop_n (tuples, n_tuples, g_cell,
+                                              this->scores);
 
-         /* for all bases */
+         c = 0.0f;
+         x = 0;
          for (m = 0; m < alpha_size; m++)
          {
-
-            /* for all bases */
             for (n = 0; n < alpha_size; n++)
             {
-               p_bb = seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pj1 - 1, sm);
+               p_mn = p_i1p[m] * p_j2p[n];
 
-               /* for all bases */
                for (o = 0; o < alpha_size; o++)
                {
-                  /* i1 */
-                  p =  p_bp2 * p_bb
-                     * seqmatrix_get_probability(bpp, pj1, sm)
-                     * seqmatrix_get_probability(o, pj2 + 1, sm);
-
-                  cell_i1 += p * nn_scores_get_G_internal_1x2_loop (row,
-                                                                    bpp,
-                                                                    m,
-                                                                    o,
-                                                                    n,
-                                                                    bj,
-                                                                    bi,
-                                                                  this->scores);
-
-                  /* j1 */
-                  p =  p_bp2 * p_bb
-                     * seqmatrix_get_probability(bpp, pi1, sm)
-                     * seqmatrix_get_probability(o, pj2 + 1, sm);
-
-                  cell_j1 += p * nn_scores_get_G_internal_1x2_loop (bpp,
-                                                                    row,
-                                                                    m,
-                                                                    o,
-                                                                    n,
-                                                                    bj,
-                                                                    bi,
-                                                                  this->scores);
-
-                  /* i2 */
-                  p =  p_bp1 * p_bb
-                     * seqmatrix_get_probability(bpp,  pj2, sm)
-                     * seqmatrix_get_probability(o, pj2 + 1, sm);
-
-                  cell_i2 += p * nn_scores_get_G_internal_1x2_loop (bi,
-                                                                    bj,
-                                                                    m,
-                                                                    o,
-                                                                    n,
-                                                                    bpp,
-                                                                    row,
-                                                                  this->scores);
-
-               /* j2 */
-               p =  p_bp1 * p_bb
-                  * seqmatrix_get_probability(bpp,  pi2, sm)
-                  * seqmatrix_get_probability(o, pj2 + 1, sm);
-               
-               cell_j2 += p * nn_scores_get_G_internal_1x2_loop (bi,
-                                                                 bj,
-                                                                 m,
-                                                                 o,
-                                                                 n,
-                                                                 row,
-                                                                 bpp,
-                                                                 this->scores);
+                  g = g_cell[x];
+                  c += p_mn * p_j1m[o] * g;
+                  g_bar[x] += p_bb * g;
+                  x++;
                }
             }
          }
+
+         t_in[k]  += p_bp2 * c;
+         t_out[l] += p_bp1 * c;
+      }
+   }
+
+   /* contract the pair summed table for each unpaired site */
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
+   {
+      for (n = 0; n < alpha_size; n++)
+      {
+         for (o = 0; o < alpha_size; o++)
+         {
+            g = g_bar[x];
+            u_i1p[m] += g * p_j2p[n] * p_j1m[o];
+            u_j2p[n] += g * p_i1p[m] * p_j1m[o];
+            u_j1m[o] += g * p_i1p[m] * p_j2p[n];
+            x++;
+         }
       }
    }
+
    /* 7 bases are involved in a 1x2 loop*/
-   cell_i1 = cell_i1 / 7; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 7; /* SB 08-12-12 */
-   cell_i2 = cell_i2 / 7; /* SB 08-12-12 */
-   cell_j2 = cell_j2 / 7; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2, sm);
+   scmf_rna_opt_add_int_paired (t_out, t_in, 7.0f, alpha_size,
+                                pi1, pj1, pi2, pj2, sm, this);
+   for (k = 0; k < alpha_size; k++)
+   {
+      scmf_rna_opt_add_2_eeff (u_i1p[k] / 7, k, pi1 + 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_j1m[k] / 7, k, pj1 - 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_j2p[k] / 7, k, pj2 + 1, this); /* SB 08-12-12 */
+   }
+}
 
-   /* design unpaired bases */
-   cell_i1 = 0.0f;
-   cell_j1 = 0.0f;
-   cell_i2 = 0.0f;
+static void
+scmf_rna_opt_calc_int11 (unsigned long allowed_bp,
+                         unsigned long alpha_size,
+                         unsigned long pi1, unsigned long pj1,
+                         unsigned long pi2, unsigned long pj2,
+                         SeqMatrix* sm,
+                         Scmf_Rna_Opt_data* this)
+{
+   unsigned long k, l, m, n, x, n_tuples;
+   char bi, bj, bi2, bj2;
+   float p_bp1, p_bp2, p_bb, g, c;
+   char* tuples;                /* loops of one pair of closing pairs */
+   float* g_cell;               /* their energies */
+   float* t_out;                /* contracted over all but the outer pair */
+   float* t_in;                 /* contracted over all but the inner pair */
+   float* p_i1p;                /* probabilities of the unpaired bases */
+   float* p_j1m;
+   float* u_i1p;                /* energies of the unpaired sites */
+   float* u_j1m;
+   float* g_bar;                /* loop table summed over closing pairs */
+
+   t_out = this->int_scratch;
+   t_in  = t_out + allowed_bp;
+   p_i1p = t_in  + allowed_bp;
+   p_j1m = p_i1p + alpha_size;
+   u_i1p = p_j1m + alpha_size;
+   u_j1m = u_i1p + alpha_size;
+   g_bar = u_j1m + alpha_size;
+   n_tuples = alpha_size * alpha_size;
+   g_cell = g_bar + n_tuples;
+   tuples = (char*) (g_cell + n_tuples);
+
+   scmf_rna_opt_fetch_col_probs (p_i1p, pi1 + 1, alpha_size, sm);
+   scmf_rna_opt_fetch_col_probs (p_j1m, pj1 - 1, alpha_size, sm);
 
-   /* for all possible pairs */
    for (k = 0; k < allowed_bp; k++)
    {
+      t_out[k] = 0.0f;
+      t_in[k] = 0.0f;
+   }
+   for (k = 0; k < alpha_size; k++)
+   {
+      u_i1p[k] = 0.0f;
+      u_j1m[k] = 0.0f;
+   }
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
+   {
+      for (n = 0; n < alpha_size; n++)
+      {
+         g_bar[x] = 0.0f;
+         /* unpaired bases of the loop tuples stay fixed */
+         tuples[(x * 6) + 2] = (char) m;
+         tuples[(x * 6) + 3] = (char) n;
+         x++;
+      }
+   }
+
+   /* contract the 1x1 table for all combinations of closing pairs */
+   for (k = 0; k < allowed_bp; k++)
+   {
+      /* outer pair (i1, j1) */
       nn_scores_get_allowed_basepair (k, &bi, &bj, this->scores);
 
       p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
          * seqmatrix_get_probability(bj, pj1, sm);
 
-      /* for all possible pairs */
       for (l = 0; l < allowed_bp; l++)
       {
-         nn_scores_get_allowed_basepair (l, &bi2, &bj2, this->scores);
+         /* inner pair (j2, i2) */
+         nn_scores_get_allowed_basepair (l, &bj2, &bi2, this->scores);
+
+         p_bp2 = seqmatrix_get_probability(bj2, pj2, sm)
+            * seqmatrix_get_probability(bi2, pi2, sm);
+         p_bb = p_bp1 * p_bp2;
 
-         p_bp2 = p_bp1 * seqmatrix_get_probability(bi2,  pi2, sm)
-            * seqmatrix_get_probability(bj2, pj2, sm);
+         /* fetch the whole table for this pair of closing pairs at once */
+         for (x = 0; x < n_tuples; x++)
+         {
+            tuples[(x * 6) + 0] = bi;
+            tuples[(x * 6) + 1] = bj;
+            tuples[(x * 6) + 4] = bi2;
+            tuples[(x * 6) + 5] = bj2;
+         }
+         nn_scores_get_G_internal_1x1_loop_n (tuples, n_tuples, g_cell,
+                                              this->scores);
 
-         /* for all bases */
+         c = 0.0f;
+         x = 0;
          for (m = 0; m < alpha_size; m++)
          {
-
-            /* for all bases */
             for (n = 0; n < alpha_size; n++)
             {
-               /* i1 + 1 */
-               p =  p_bp2
-                  * seqmatrix_get_probability(n, pj2 + 1, sm)
-                  * seqmatrix_get_probability(m, pj1 - 1, sm);
-
-               cell_i1 += p * nn_scores_get_G_internal_1x2_loop (bi,
-                                                                 bj,
-                                                                 row,
-                                                                 n,
-                                                                 m,
-                                                                 bj2,
-                                                                 bi2,
-                                                                 this->scores);
-
-               /* j1 - 1 */
-               p =  p_bp2
-                  * seqmatrix_get_probability(n, pj2 + 1, sm)
-                  * seqmatrix_get_probability(m, pi1 + 1, sm);
-
-               cell_j1 += p * nn_scores_get_G_internal_1x2_loop (bi,
-                                                                 bj,
-                                                                 m,
-                                                                 n,
-                                                                 row,
-                                                                 bj2,
-                                                                 bi2,
-                                                                 this->scores);
-
-               /* j2 + 1 */
-               p =  p_bp2
-                  * seqmatrix_get_probability(n, pj1 - 1, sm)
-                  * seqmatrix_get_probability(m, pi1 + 1, sm);
-
-               cell_i2 += p * nn_scores_get_G_internal_1x2_loop (bi,
-                                                                 bj,
-                                                                 m,
-                                                                 row,
-                                                                 n,
-                                                                 bj2,
-                                                                 bi2,
-                                                                 this->scores);
+               g = g_cell[x];
+               c += p_i1p[m] * p_j1m[n] * g;
+               g_bar[x] += p_bb * g;
+               x++;
             }
          }
+
+         t_in[k]  += p_bp2 * c;
+         t_out[l] += p_bp1 * c;
       }
    }
-   /* 7 bases are involved in a 1x2 loop*/
-   cell_i1 = cell_i1 / 7; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 7; /* SB 08-12-12 */
-   cell_i2 = cell_i2 / 7; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1 + 1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1 - 1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pj2 + 1, sm);
-}
-
-static __inline__ void
-scmf_rna_opt_calc_int11 (const unsigned long row,
-                         unsigned long allowed_bp,
-                         unsigned long alpha_size,
-                         unsigned long pi1, unsigned long pj1,
-                         unsigned long pi2, unsigned long pj2,
-                         SeqMatrix* sm,
-                         Scmf_Rna_Opt_data* this)
-{
-   unsigned long k, l, m, n;
-
-   float cell_i1 = 0.0f;
-   float cell_j1 = 0.0f;
-   float cell_i2 = 0.0f;
-   float cell_j2 = 0.0f;
-   char bpp, bi, bj, bi2, bj2;
-   float p_bp2, p_bp1, p;
 
-   /* for all allowed pairs */
-   for (k = 0; this->bp_allowed[row][k] != 0; k++)
+   /* contract the pair summed table for each unpaired site */
+   x = 0;
+   for (m = 0; m < alpha_size; m++)
    {
-      bpp = (char) (this->bp_allowed[row][k] - 1);
-      
-      /* for all possible pairs */
-      for (l = 0; l < allowed_bp; l++)
+      for (n = 0; n < alpha_size; n++)
       {
-         nn_scores_get_allowed_basepair (l, &bi, &bj, this->scores);
-         
-         p_bp2 = seqmatrix_get_probability(bi, pi2, sm)
-            * seqmatrix_get_probability(bj, pj2, sm);
-         
-         p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
-            * seqmatrix_get_probability(bj, pj1, sm);
-         
-         /* for all bases */
-         for (m = 0; m < alpha_size; m++)
-         {
-            /* for all bases */
-            for (n = 0; n < alpha_size; n++)
-            {
-               p = seqmatrix_get_probability(bpp, pj1, sm)
-                  * p_bp2
-                  * seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pj1 - 1, sm);
-               
-               cell_i1 += p * nn_scores_get_G_internal_1x1_loop (row, bpp,
-                                                                 m, n,
-                                                                 bi, bj,
-                                                                 this->scores);
-
-               p = seqmatrix_get_probability(bpp, pi1, sm)
-                  * p_bp2
-                  * seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pj1 - 1, sm);
-               
-               cell_j1 += p * nn_scores_get_G_internal_1x1_loop (bpp, row,
-                                                                 m, n,
-                                                                 bi, bj,
-                                                                 this->scores);
-               
-               p = p_bp1
-                  * seqmatrix_get_probability(bpp, pj2, sm)
-                  * seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pj1 - 1, sm);
-               
-               cell_i2 += p * nn_scores_get_G_internal_1x1_loop (bi, bj,
-                                                                 m, n,
-                                                                 row, bpp,
-                                                                 this->scores);
-               
-               p = p_bp1
-                  * seqmatrix_get_probability(bpp, pi2, sm)
-                  * seqmatrix_get_probability(m, pi1 + 1, sm)
-                  * seqmatrix_get_probability(n, pj1 - 1, sm);
-               
-               cell_j2 += p * nn_scores_get_G_internal_1x1_loop (bi, bj,
-                                                                 m, n,
-                                                                 bpp, row,
-                                                                 this->scores);
-            }
-         }
+         u_i1p[m] += g_bar[x] * p_j1m[n];
+         u_j1m[n] += g_bar[x] * p_i1p[m];
+         x++;
       }
    }
-   /* each of the 6 bases involved in this loop gets an energy contribution */
-   cell_i1 = cell_i1 / 6; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 6; /* SB 08-12-12 */
-   cell_i2 = cell_i2 / 6; /* SB 08-12-12 */
-   cell_j2 = cell_j2 / 6; /* SB 08-12-12 */
-/*   if (pj1 == 14)
-      mprintf("Q %lu,%lu: %f\n", row, pj1, cell_j1);
-   if (pi1 == 3)
-      mprintf("Q %lu,%lu: %f\n", row, pi1, cell_i1);
-   if (pj2 == 14)
-      mprintf("W %lu,%lu: %f\n", row, pj2, cell_j2);
-   if (pi2 == 3)
-   mprintf("W %lu,%lu: %f\n", row, pi2, cell_i2);*/
-   seqmatrix_add_2_eeff (cell_i1, row, pi1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1, sm);
-   seqmatrix_add_2_eeff (cell_i2, row, pi2, sm);
-   seqmatrix_add_2_eeff (cell_j2, row, pj2, sm);
 
-   /* design unpaired bases */
-   cell_i1 = 0.0f;
-   cell_j1 = 0.0f;
-   /* for all possible pairs */
-   for (k = 0; k < allowed_bp; k++)
+   /* each of the 6 bases involved in this loop gets an energy contribution */
+   scmf_rna_opt_add_int_paired (t_out, t_in, 6.0f, alpha_size,
+                                pi1, pj1, pi2, pj2, sm, this);
+   for (k = 0; k < alpha_size; k++)
    {
-      nn_scores_get_allowed_basepair (k, &bi, &bj, this->scores);
-      
-      p_bp1 = seqmatrix_get_probability(bi, pi1, sm)
-         * seqmatrix_get_probability(bj, pj1, sm);
-      
-      /* for all possible pairs */
-      for (l = 0; l < allowed_bp; l++)
-      {
-         nn_scores_get_allowed_basepair (l, &bi2, &bj2, this->scores);
-         
-         p_bp2 = p_bp1
-            * seqmatrix_get_probability(bi2, pi2, sm)
-            * seqmatrix_get_probability(bj2, pj2, sm);
-         
-         /* for all bases */
-         for (m = 0; m < alpha_size; m++)
-         {
-            cell_i1 += p_bp2 * seqmatrix_get_probability(m, pj1 - 1, sm)
-               * nn_scores_get_G_internal_1x1_loop (bi, bj,
-                                                    row, m,
-                                                    bi2, bj2,
-                                                    this->scores);
-            
-            cell_j1 += p_bp2 * seqmatrix_get_probability(m, pi1 + 1, sm)
-               * nn_scores_get_G_internal_1x1_loop (bi, bj,
-                                                    m, row,
-                                                    bi2, bj2,
-                                                    this->scores);
-         }
-      }
+      scmf_rna_opt_add_2_eeff (u_i1p[k] / 6, k, pi1 + 1, this); /* SB 08-12-12 */
+      scmf_rna_opt_add_2_eeff (u_j1m[k] / 6, k, pj1 - 1, this); /* SB 08-12-12 */
    }
-   /* each of the 6 bases involved in this loop gets an energy contribution */
-   cell_i1 = cell_i1 / 6; /* SB 08-12-12 */
-   cell_j1 = cell_j1 / 6; /* SB 08-12-12 */
-   seqmatrix_add_2_eeff (cell_i1, row, pi1 + 1, sm);
-   seqmatrix_add_2_eeff (cell_j1, row, pj1 - 1, sm);
 }
 
 static void
-scmf_rna_opt_calc_internals (const unsigned long row,
-                             const unsigned long loop,
+scmf_rna_opt_calc_internals (const unsigned long loop,
                              unsigned long alpha_size,
                              unsigned long allowed_bp,
                              SeqMatrix* sm,
@@ -2260,6 +2652,7 @@ scmf_rna_opt_calc_internals (const unsigned long row,
 {
    unsigned long pi1, pj1, size1;
    unsigned long pi2, pj2, size2;
+   unsigned long row;
 
    /* fetch loop geometry */
    secstruct_get_geometry_internal (&pi1, &pj1, &pi2, &pj2, &size1, &size2,
@@ -2273,32 +2666,35 @@ scmf_rna_opt_calc_internals (const unsigned long row,
    if ((size1 == 1) && (size2 == 1))
    {
       /* 1x1 internal loop */
-      scmf_rna_opt_calc_int11 (row, allowed_bp, alpha_size, 
+      scmf_rna_opt_calc_int11 (allowed_bp, alpha_size,
                                pi1, pj1, pi2, pj2, sm, this);
    }
    else if ((size1 == 1) && (size2 == 2))
    {
       /* 1x2 internal loop */
-      scmf_rna_opt_calc_int12 (row, allowed_bp, alpha_size, 
+      scmf_rna_opt_calc_int12 (allowed_bp, alpha_size,
                                pi1, pj1, pi2, pj2, sm, this);
    }
    else if ((size1 == 2) && (size2 == 1))
    {
       /* 2x1 internal loop */
-      scmf_rna_opt_calc_int12 (row, allowed_bp, alpha_size, 
+      scmf_rna_opt_calc_int12 (allowed_bp, alpha_size,
                                pj2, pi2, pj1, pi1, sm, this);
    }
    else if ((size1 == 2) && (size2 == 2))
    {
       /* 2x2 internal loop */
-      scmf_rna_opt_calc_int22 (row, allowed_bp, alpha_size, 
+      scmf_rna_opt_calc_int22 (allowed_bp, alpha_size,
                                pi1, pj1, pi2, pj2, sm, this);
    }
    else
    {
       /* generic internal loop */
-      scmf_rna_opt_calc_internal (row, allowed_bp, alpha_size, 
-                                  pi1, pj1, pi2, pj2, sm, this);      
+      for (row = 0; row < alpha_size; row++)
+      {
+         scmf_rna_opt_calc_internal (row, allowed_bp, alpha_size,
+                                     pi1, pj1, pi2, pj2, sm, this);
+      }
    }
 }
 
@@ -2358,312 +2754,644 @@ scmf_rna_opt_get_interaction_energy (char state,
    return pe;
 }
 
-static void
-scmf_rna_opt_calc_upstream_cont (const unsigned long state,
-                                 const unsigned long j,
-                                 const unsigned long allowed_bp,
-                                 const Scmf_Rna_Opt_data* this,
-                                 const SeqMatrix* sm)
+/* Sum of the dinucleotide probabilities (a,b) at (k - 1, k) over k in
+   [from + 1, to], taken from the prefix sums; zero for empty ranges. */
+static __inline__ void
+scmf_rna_opt_neg_pre_range (float* sum,
+                            const unsigned long from,
+                            const unsigned long to,
+                            const unsigned long a2,
+                            const Scmf_Rna_Opt_data* this)
 {
-   unsigned long abp, bp;
-   char bip, bjm, bj;
+   unsigned long k;
 
-   for (abp = 0; this->bp_allowed[state][abp] != 0; abp++)
+   if (from < to)
+   {
+      for (k = 0; k < a2; k++)
+      {
+         sum[k] = this->neg_pre[(to * a2) + k] - this->neg_pre[(from * a2) + k];
+      }
+   }
+   else
    {
-      bj = (char) (this->bp_allowed[state][abp] - 1);
+      memset (sum, 0, a2 * sizeof (*sum));
+   }
+}
 
-      for (bp = 0; bp < allowed_bp; bp++)
+/* Negative design term for all states and sites. Stacks of a base with any
+   possible partner are counted with the probabilities of the neighbouring
+   bases. The probabilities of all dinucleotides (a, b) at (j - 1, j) are
+   summed up once into prefix sums over the sites, which are shared by all
+   states.
+   By default, stacks are counted with a quasi force-field over the whole
+   sequence: upstream of a site, stacks are weighted by 0.75 for the whole
+   sequence minus 0.5 for the part upstream, downstream by 0.5 for the part
+   downstream. With a maximum span set, unwanted stacked pairs are counted
+   exactly for all pairs (i, j) with a hairpin of at least 3 bases and
+   j - i not above the span. Since the sum over a band of partners is the
+   difference of two prefix sums, the costs do not depend on the span. This
+   also holds for SCMF_RNA_OPT_NEG_SPAN_ALL, which counts all unwanted
+   pairs of the sequence exactly in linear time. */
+static void
+scmf_rna_opt_calc_neg_design (const unsigned long n_sites,
+                              const unsigned long allowed_bp,
+                              const unsigned long alpha_size,
+                              const Scmf_Rna_Opt_data* this,
+                              SeqMatrix* sm)
+{
+   unsigned long j, s, x, k, paired_2, hi, lo;
+   unsigned long a2 = alpha_size * alpha_size;
+   float* pre;
+   float* w_up;
+   float* w_dn;
+   float* c;
+   float en, prob;
+
+   assert (n_sites > 1);
+
+   scmf_rna_opt_init_neg_coef (allowed_bp, alpha_size,
+                               (this->neg_span > 0) ? 1.0f : 0.5f, this);
+   scmf_rna_opt_calc_neg_pre (n_sites, alpha_size, this, sm);
+
+   w_up = this->neg_pre + (n_sites * a2);
+   w_dn = w_up + a2;
+
+   for (j = 0; j < n_sites; j++)
+   {
+      if (!seqmatrix_is_col_fixed (j, sm))
       {
-         nn_scores_get_allowed_basepair (bp, &bjm, &bip, this->scores);
+         pre = this->neg_pre + (j * a2);
+         paired_2 = rna_base_pairs_with (j, this->rna);
 
-/* SB 04-09-09
-         this->en_neg[(int)bip] -= (nn_scores_get_G_stack (state, bj, bjm, bip,
-                                                           this->scores)
-                                    * seqmatrix_get_probability (bjm, (j-1),sm)
-                                    * seqmatrix_get_probability (bj, j, sm));
-*/
-         this->en_neg[(int)bip] -= (nn_scores_get_G_stack (state, bj, bjm, bip,
-                                                           this->scores) * 0.5f
-                                    * seqmatrix_get_probability (bjm, (j-1),sm)
-                                    * seqmatrix_get_probability (bj, j, sm)); /*SB 04-09-09 */
+         if (this->neg_span == 0)
+         {
+            for (k = 0; k < a2; k++)
+            {
+               w_up[k] = (0.75f * this->neg_pre[((n_sites - 1) * a2) + k])
+                  - (0.5f * pre[k]);
+               w_dn[k] = pre[k];
+            }
+         }
+         else
+         {
+            /* pairs (j, p) stacking on (j + 1, p - 1), p in [j + 6, hi] */
+            hi = (this->neg_span < (n_sites - j)) ?
+               (j + this->neg_span) : (n_sites - 1);
+            scmf_rna_opt_neg_pre_range (w_up, j + 5, hi, a2, this);
+
+            /* pairs (p, j) stacking on (p + 1, j - 1), p in [lo, j - 6] */
+            lo = (j > this->neg_span) ? (j - this->neg_span) : 0;
+            scmf_rna_opt_neg_pre_range (w_dn, lo, (j > 5) ? (j - 5) : 0,
+                                        a2, this);
+
+            /* the wanted partner does not count */
+            if ((paired_2 != NOT_PAIRED) && (paired_2 >= (j + 6))
+                && (paired_2 <= hi))
+            {
+               for (k = 0; k < a2; k++)
+               {
+                  w_up[k] -= (this->neg_pre[(paired_2 * a2) + k]
+                              - this->neg_pre[((paired_2 - 1) * a2) + k]);
+               }
+            }
+            else if ((paired_2 != NOT_PAIRED) && (paired_2 >= lo)
+                     && ((paired_2 + 6) <= j))
+            {
+               for (k = 0; k < a2; k++)
+               {
+                  w_dn[k] -= (this->neg_pre[((paired_2 + 1) * a2) + k]
+                              - this->neg_pre[(paired_2 * a2) + k]);
+               }
+            }
+         }
+
+         for (s = 0; s < alpha_size; s++)
+         {
+            prob = 0.0f;
+
+            /* stacks with the base upstream */
+            if (j < (n_sites - 1))
+            {
+               c = this->neg_coef + (s * a2 * alpha_size);
+               for (x = 0; x < alpha_size; x++)
+               {
+                  en = 0.0f;
+                  for (k = 0; k < a2; k++)
+                  {
+                     en += c[(x * a2) + k] * w_up[k];
+                  }
+                  prob += (en * seqmatrix_get_probability (x, j + 1, sm));
+               }
+            }
+
+            /* stacks with the base downstream */
+            if (j > 0)
+            {
+               c = this->neg_coef + ((alpha_size + s) * a2 * alpha_size);
+               for (x = 0; x < alpha_size; x++)
+               {
+                  en = 0.0f;
+                  for (k = 0; k < a2; k++)
+                  {
+                     en += c[(x * a2) + k] * w_dn[k];
+                  }
+                  prob += (en * seqmatrix_get_probability (x, j - 1, sm));
+               }
+            }
+
+            /* remove possible interaction */
+            if ((paired_2 != NOT_PAIRED) && (this->neg_span == 0))
+            {
+               prob -= scmf_rna_opt_get_interaction_energy ((char) s, j,
+                                                            paired_2,
+                                                            allowed_bp,
+                                                            this, sm);
+            }
+
+            seqmatrix_add_2_eeff ((prob/n_sites) * -1.0f * this->neg_scale,
+                                  s, j, sm);
+         }
       }
    }
 }
 
 static void
-scmf_rna_opt_calc_downstream_cont (const unsigned long state,
-                                   const unsigned long i,
-                                   const unsigned long allowed_bp,
-                                   const Scmf_Rna_Opt_data* this,
-                                   const SeqMatrix* sm)
+scmf_rna_opt_calc_het_terms (const unsigned long n_sites,
+                             const unsigned long alpha_size,
+                             const Scmf_Rna_Opt_data* this,
+                             SeqMatrix* sm)
 {
-   unsigned long abp, bp;
-   char bi, bip, bjm;
+   unsigned long s_c, state, lo, hi;
+   float* pre;
+   float het;
+
+   assert (this->win < (n_sites / 2));
+   assert (this->col_agg);
 
-   for (abp = 0; this->bp_allowed[state][abp] != 0; abp++)
+   /* pre[state][k] = sum of P(state, i) over i in [0, k] */
+   for (state = 0; state < alpha_size; state++)
    {
-      bi = (char)(this->bp_allowed[state][abp] - 1);
+      pre = this->col_agg[state];
+      pre[0] = seqmatrix_get_probability (state, 0, sm);
+      for (s_c = 1; s_c < n_sites; s_c++)
+      {
+         pre[s_c] = pre[s_c - 1] + seqmatrix_get_probability (state, s_c, sm);
+      }
+   }
 
-      for (bp = 0; bp < allowed_bp; bp++)
+   for (s_c = 0; s_c < n_sites; s_c += 2) /* SBhet 30-12-09 */
+   {
+      lo = (s_c > this->win) ? (s_c - this->win) : 0;
+      hi = ((s_c + this->win) < n_sites) ? (s_c + this->win) : (n_sites - 1);
+
+      for (state = 0; state < alpha_size; state++)
       {
-         nn_scores_get_allowed_basepair (bp, &bip, &bjm, this->scores);
+         pre = this->col_agg[state];
+         het = pre[hi] - pre[s_c];
+         if (s_c > 0)
+         {
+            het += pre[s_c - 1];
+         }
+         if (lo > 0)
+         {
+            het -= pre[lo - 1];
+         }
 
-/* SB 04-09-09
-      this->en_neg_35[0][(int)bjm] += (nn_scores_get_G_stack (bi,state,bjm,bip,
-                                                              this->scores)
-                                       * seqmatrix_get_probability (bi, i, sm)
-                                 * seqmatrix_get_probability (bip, i + 1, sm));
-*/
-      this->en_neg_35[0][(int)bjm] += (nn_scores_get_G_stack (bi,state,bjm,bip,
-                                                              this->scores) * 0.5f
-                                       * seqmatrix_get_probability (bi, i, sm)
-                                 * seqmatrix_get_probability (bip, i + 1, sm));  /*SB 04-09-09 */
+         seqmatrix_add_2_eeff ((het / (hi - lo)) * this->het_scale,
+                               state, s_c, sm);
       }
    }
 }
 
 static void
-scmf_rna_opt_calc_neg_loop (const unsigned long state,
+scmf_rna_opt_calc_nun_term (const unsigned long state,
                             const unsigned long n_sites,
-                            const unsigned long allowed_bp,
                             const unsigned long alpha_size,
                             const Scmf_Rna_Opt_data* this,
                             SeqMatrix* sm)
 {
-   /* called for each state seperately */
-   unsigned long j, abp, bp, paired_2;
-   char bj, bip, bjm;
-   float prob;
-
-   /* init upstream direction */
-   /* Idea: For the first state, add up all negative interactions. But only
-            count energies multiplied with probabilities INDEPENDENT of the
-            first position (that is j, j-1 since cur.state is i, i+1 is not
-            independent). This gives us a quasi force-field which can be
-            iterated to produce neg.design terms for all other sites. This
-            turns the naive quadratic approach into linear time. */
+   unsigned long i;             /* iterates sites */
+   unsigned long n;             /* iterates the alphabet */
+   unsigned long mate;
+   float cell;
 
-   memset(this->en_neg, 0, alpha_size * sizeof (*(this->en_neg)));
-   memset(this->en_neg_35[0], 0, alpha_size * sizeof(**(this->en_neg_35)));
+   assert (this);
+   assert (this->scores);
+   assert (this->rna);
 
-   /* walk over all pairing partners of given state */
-   for (abp = 0; this->bp_allowed[state][abp] != 0; abp++)
+   for (i = 0; i < n_sites; i++)
    {
-      bj = (char) (this->bp_allowed[state][abp] - 1);
-      
-      /* stack with all pairs allowed in our alphabet */
-      for (bp = 0; bp < allowed_bp; bp++)
+      mate = rna_base_pairs_with (i, this->rna);
+      if (mate != NOT_PAIRED)
       {
-         nn_scores_get_allowed_basepair (bp, &bjm, &bip, this->scores);
-         
-         /* iterate all but the first site to be the j-side in a pair */
-         prob = 0.0f;
-         for (j = 1; j < n_sites; j++)
+         cell = 0.0f;
+         for (n = 0; n < alpha_size; n++)
          {
-            prob += (seqmatrix_get_probability (bjm, (j - 1), sm)
-                   * seqmatrix_get_probability (bj,   j,      sm));
+            cell += (seqmatrix_get_probability(n, mate, sm) 
+                     * nn_scores_get_nun_penalty (n, state, this->scores));
          }
-         this->en_neg[(int)bip] += (nn_scores_get_G_stack (state, bj, bjm, bip,
-                                                           this->scores)
-                                    * 0.75f * prob);
+         /* add to Eeff */
+         seqmatrix_add_2_eeff (cell, state, i, sm);
       }
    }
+}
+
+/* Decide whether a structure element has to be recalculated, that is if it
+   was never calculated or its columns drifted by more than the tolerance
+   since. The drift adds up the largest change of its columns of each step.
+   If recalculated, its cached contributions are dropped. */
+static bool
+scmf_rna_opt_elem_is_dirty (const unsigned long elem,
+                            const SeqMatrix* sm,
+                            Scmf_Rna_Opt_data* this)
+{
+   unsigned long i;
+   float change, max_change = 0.0f;
+   bool dirty;
+
+   assert (elem < this->n_elems);
 
-   /* iterate over all sites */
-   /* treat site 0 as special case */
-   if (!seqmatrix_is_col_fixed (0, sm))
+   dirty = (ARRAY_CURRENT(this->elem_cache[elem]) == 0);
+   for (i = 0; (!dirty) && (i < ARRAY_CURRENT(this->elem_cache[elem])); i++)
    {
-      prob = 0.0f;
-      for (abp = 0; abp < alpha_size; abp++)
+      change = seqmatrix_get_col_change (
+         ARRAY_ACCESS(this->elem_cache[elem], i).col, sm);
+      if (change > max_change)
       {
-         prob += (this->en_neg[abp] * seqmatrix_get_probability (abp, 1, sm));
-      }
-      
-      if ((paired_2 = rna_base_pairs_with (0, this->rna)) != NOT_PAIRED)
-      {
-         prob -= scmf_rna_opt_get_interaction_energy ((char) state, 0, paired_2,
-                                                      allowed_bp,
-                                                      this, sm);
+         max_change = change;
       }
+   }
 
-      seqmatrix_add_2_eeff ((prob/n_sites) * -1.0f * this->neg_scale, state, 0,
-                            sm);
+   if (!dirty)
+   {
+      this->drift[elem] += max_change;
+      dirty = (this->drift[elem] > this->dirty_tol);
    }
 
-   scmf_rna_opt_calc_upstream_cont (state, 1, allowed_bp, this, sm);
-   scmf_rna_opt_calc_downstream_cont (state, 0, allowed_bp, this, sm);
+   if (dirty)
+   {
+      ARRAY_RESET(this->elem_cache[elem]);
+      this->drift[elem] = 0.0f;
+   }
+
+   return dirty;
+}
 
-   for (j = 1; j < (n_sites - 1); j++)
+/* Evaluate a structure element for all states, recording its contributions
+   to the Eeff matrix in the elements cache. */
+static void
+scmf_rna_opt_calc_elem (const unsigned long elem,
+                        unsigned long alpha_size,
+                        unsigned long allowed_bp,
+                        SeqMatrix* sm,
+                        Scmf_Rna_Opt_data* this)
+{
+   unsigned long r;
+   unsigned long i;
+   unsigned long n_states;
+
+   this->rec = &(this->elem_cache[elem]);
+   i = this->elems[elem].idx;
+   n_states = seqmatrix_get_rows (sm);
+
+   switch (this->elems[elem].kind)
    {
-      if (!seqmatrix_is_col_fixed (j, sm))
-      {
-         /* create current neg. design term */
-         prob = 0.0f;
-         
-         /* add all contributions of possible stacking pairing parnters */
-         for (abp = 0; abp < alpha_size; abp++)
+      case SCMF_ELEM_INTERNAL:
+         /* internal loops, processed for all states at once */
+         scmf_rna_opt_calc_internals (i, alpha_size, allowed_bp, sm, this);
+         break;
+      case SCMF_ELEM_TETRA:
+         /* tetraloop bonus of hairpin loops, for all states at once */
+         scmf_rna_opt_calc_tetra_loop (i, sm, this);
+         break;
+      case SCMF_ELEM_EXT:
+         for (r = 0; r < n_states; r++)
          {
-            prob += (this->en_neg[abp] 
-                     * seqmatrix_get_probability (abp, j + 1, sm));
-            prob += (this->en_neg_35[0][abp]
-                     * seqmatrix_get_probability (abp, (j - 1), sm));
+            scmf_rna_opt_calc_ext_loop (r, alpha_size, allowed_bp, sm, this);
          }
-         
-         /*   remove possible interaction */      
-         if ((paired_2 = rna_base_pairs_with (j, this->rna)) != NOT_PAIRED)
+         break;
+      case SCMF_ELEM_STACK:
+         for (r = 0; r < n_states; r++)
          {
-            prob -= scmf_rna_opt_get_interaction_energy ((char) state, j,
-                                                         paired_2,
-                                                         allowed_bp,
-                                                         this, sm);
+            scmf_rna_opt_calc_stack (r, i, allowed_bp, sm, this);
          }
-         
-         
-         /* if we pair, we have stacks (i, i+1, site-1, site) and
-            (site, site+1, j-1, j) counted without need */
-         
-         /*   store */
-         /*mfprintf (stdout, "%lu,%lu: %f\n", state, j, prob);*/
-         seqmatrix_add_2_eeff ((prob/n_sites) * -1.0f * this->neg_scale, state,
-                               j,
-                               sm);
-      }
+         break;
+      case SCMF_ELEM_BULGE:
+         for (r = 0; r < n_states; r++)
+         {
+            scmf_rna_opt_calc_bulge (r, i, allowed_bp, sm, this);
+         }
+         break;
+      case SCMF_ELEM_HAIRPIN:
+         for (r = 0; r < n_states; r++)
+         {
+            scmf_rna_opt_calc_hairpin (r, i, alpha_size, allowed_bp, sm,
+                                       this);
+         }
+         break;
+      case SCMF_ELEM_MULTI:
+         for (r = 0; r < n_states; r++)
+         {
+            scmf_rna_opt_calc_multi_loop (r, i, alpha_size, allowed_bp, sm,
+                                          this);
+         }
+         break;
+   }
+
+   this->rec = NULL;
+}
+
+#ifdef HAVE_PTHREAD
+/* Rough estimate of the work needed to evaluate a structure element for all
+   states, used to balance the element sweep over threads. */
+static unsigned long
+scmf_rna_opt_elem_cost (const unsigned long elem,
+                        unsigned long alpha_size,
+                        unsigned long allowed_bp,
+                        Scmf_Rna_Opt_data* this)
+{
+   unsigned long pi1, pj1, size1;
+   unsigned long pi2, pj2, size2;
+   unsigned long cost;
+   SecStruct* structure;
+
+   structure = rna_get_secstruct (this->rna);
+   cost = alpha_size * allowed_bp;
 
-      /*   update downstream */
-      scmf_rna_opt_calc_downstream_cont (state, j, allowed_bp, this, sm);
+   switch (this->elems[elem].kind)
+   {
+      case SCMF_ELEM_INTERNAL:
+         secstruct_get_geometry_internal (&pi1, &pj1, &pi2, &pj2,
+                                          &size1, &size2,
+                                          this->elems[elem].idx, structure);
+         /* small loops contract a table over both closing pairs and all
+            unpaired bases, generic ones do not look at unpaired bases */
+         cost = allowed_bp * allowed_bp;
+         if ((size1 < 3) && (size2 < 3))
+         {
+            for (size1 = size1 + size2; size1 > 0; size1--)
+            {
+               cost *= alpha_size;
+            }
+         }
+         else
+         {
+            cost *= alpha_size;
+         }
+         break;
+      case SCMF_ELEM_TETRA:
+         cost = alpha_size * alpha_size;
+         break;
+      case SCMF_ELEM_EXT:
+         cost *= (  secstruct_get_noof_stems_extloop (structure)
+                  + secstruct_get_noof_5pdangles_extloop (structure)
+                  + secstruct_get_noof_3pdangles_extloop (structure)) + 1;
+         break;
+      case SCMF_ELEM_MULTI:
+         cost *= (  secstruct_get_i_noof_stems_multiloop (
+                       this->elems[elem].idx, structure)
+                  + secstruct_get_i_noof_5pdangles_multiloop (
+                     this->elems[elem].idx, structure)
+                  + secstruct_get_i_noof_3pdangles_multiloop (
+                     this->elems[elem].idx, structure));
+         break;
+      case SCMF_ELEM_BULGE:
+      case SCMF_ELEM_HAIRPIN:
+         cost *= allowed_bp;
+         break;
+      case SCMF_ELEM_STACK:
+         break;
+   }
 
-      /*   update upstream */
-      scmf_rna_opt_calc_upstream_cont (state, j + 1, allowed_bp, this, sm);
+   return cost;
+}
 
-      /* exclude one sonderfall (0 and last) */
+static int
+scmf_rna_opt_cmp_dirty_elems (const void* a, const void* b)
+{
+   const ScmfDirtyElem* da = (const ScmfDirtyElem*) a;
+   const ScmfDirtyElem* db = (const ScmfDirtyElem*) b;
+
+   /* descending by costs, ties broken by element index */
+   if (da->cost != db->cost)
+   {
+      return (da->cost < db->cost) ? 1 : -1;
    }
 
-   if (!seqmatrix_is_col_fixed (j, sm))
+   return (da->elem < db->elem) ? -1 : (da->elem > db->elem);
+}
+
+/* Fetch elements from the queue of a sweep until it is empty. */
+static void
+scmf_rna_opt_sweep_elems (ScmfElemQueue* queue, Scmf_Rna_Opt_data* this)
+{
+   unsigned long e;
+
+   for (;;)
    {
-      /* treat last site as special case */
-      prob = 0.0f;
-      for (abp = 0; abp < alpha_size; abp++)
+      pthread_mutex_lock (&(queue->lock));
+      e = queue->next;
+      if (e < queue->n)
       {
-         prob += (this->en_neg_35[0][abp]
-                  * seqmatrix_get_probability (abp, (j - 1), sm));
+         queue->next++;
       }
-      
-      if ((paired_2 = rna_base_pairs_with (j, this->rna)) != NOT_PAIRED)
+      pthread_mutex_unlock (&(queue->lock));
+
+      if (e >= queue->n)
       {
-         prob -= scmf_rna_opt_get_interaction_energy ((char) state, j,
-                                                      paired_2, allowed_bp,
-                                                      this, sm);
+         break;
       }
-      
-      seqmatrix_add_2_eeff ((prob/n_sites) * -1.0f * this->neg_scale, state, j,
-                            sm);
+
+      scmf_rna_opt_calc_elem (queue->list[e].elem,
+                              queue->alpha_size, queue->allowed_bp, queue->sm,
+                              this);
    }
 }
 
-static void
-scmf_rna_opt_calc_het_term (const unsigned long state,
-                            const unsigned long n_sites,
-                            const Scmf_Rna_Opt_data* this,
-                            SeqMatrix* sm)
+/* Additional thread of the element sweep: sleep until a new sweep is handed
+   out, take part in it and report when done. */
+static void*
+scmf_rna_opt_elem_worker (void* arg)
 {
-   unsigned long s_c;
-   float het;
+   ScmfElemWorker* w = (ScmfElemWorker*) arg;
+   ScmfElemQueue* queue = w->queue;
 
-   assert (this->win < (n_sites / 2));
+   pthread_mutex_lock (&(queue->lock));
+   for (;;)
+   {
+      while ((!queue->stop) && (queue->round == w->round))
+      {
+         pthread_cond_wait (&(queue->start), &(queue->lock));
+      }
+      if (queue->stop)
+      {
+         break;
+      }
+      w->round = queue->round;
+      pthread_mutex_unlock (&(queue->lock));
 
-   het = 0.0f;
+      scmf_rna_opt_sweep_elems (queue, &(w->data));
 
-   /***************************************/
-   /* first try: additive, whole sequence */
-   /***************************************/
-/*    /\* calc first pos *\/ */
-/*    for (s_c = 0; s_c < n_sites; s_c++) */
-/*    { */
-/*       het += seqmatrix_get_probability (state, s_c, sm); */
-/*    } */
+      pthread_mutex_lock (&(queue->lock));
+      queue->active--;
+      if (queue->active == 0)
+      {
+         pthread_cond_signal (&(queue->done));
+      }
+   }
+   pthread_mutex_unlock (&(queue->lock));
 
-/*    /\* propagate on whole sequence *\/ */
-/*    for (s_c = 0; s_c < n_sites; s_c++) */
-/*    { */
-/*  seqmatrix_add_2_eeff (((het - seqmatrix_get_probability (state, s_c, sm)) */
-/*                             / n_sites) * this->het_scale, state, s_c, sm); */
-/*    } */
+   return NULL;
+}
 
+/* Evaluate the dirty elements using all threads. Elements are handed out
+   most expensive first, so the heavy internal loops do not pile up at the
+   end of the sweep. The calling thread takes part in the sweep. */
+static void
+scmf_rna_opt_sweep_elems_parallel (const unsigned long n_dirty,
+                                   unsigned long alpha_size,
+                                   unsigned long allowed_bp,
+                                   SeqMatrix* sm,
+                                   Scmf_Rna_Opt_data* this)
+{
+   ScmfElemQueue* queue = this->queue;
+   unsigned long t;
 
-   /***************************************/
-   /*      2nd try: additive, window      */
-   /***************************************/
-   for (s_c = 0; s_c < this->win; s_c++)
+   for (t = 0; t < n_dirty; t++)
+   {
+      this->dirty[t].cost = scmf_rna_opt_elem_cost (this->dirty[t].elem,
+                                                    alpha_size, allowed_bp,
+                                                    this);
+   }
+   qsort (this->dirty, n_dirty, sizeof (*(this->dirty)),
+          scmf_rna_opt_cmp_dirty_elems);
+
+   pthread_mutex_lock (&(queue->lock));
+   queue->list       = this->dirty;
+   queue->n          = n_dirty;
+   queue->next       = 0;
+   queue->sm         = sm;
+   queue->alpha_size = alpha_size;
+   queue->allowed_bp = allowed_bp;
+   queue->active     = this->n_workers;
+   queue->round++;
+   pthread_cond_broadcast (&(queue->start));
+   pthread_mutex_unlock (&(queue->lock));
+
+   scmf_rna_opt_sweep_elems (queue, this);
+
+   pthread_mutex_lock (&(queue->lock));
+   while (queue->active > 0)
    {
-      het += seqmatrix_get_probability (state, s_c, sm);
+      pthread_cond_wait (&(queue->done), &(queue->lock));
    }
+   pthread_mutex_unlock (&(queue->lock));
 
-   /* pos 0 up to window size */
-   for (s_c = 0; (s_c < this->win) && ((s_c + this->win) < n_sites); s_c++)
+   for (t = 0; t < this->n_workers; t++)
    {
-      het += seqmatrix_get_probability (state, (s_c + this->win), sm);
-      if (s_c % 2 == 0) {/* SBhet 30-12-09 */
-      seqmatrix_add_2_eeff (((het - seqmatrix_get_probability (state, s_c, sm))
-                             / (s_c + this->win)) 
-                            * this->het_scale, state, s_c, sm);
-      }/* SBhet 30-12-09 */
+      this->rec_error |= this->workers[t].data.rec_error;
+      this->workers[t].data.rec_error = 0;
    }
+}
 
-   /* slide until window reaches last pos */
-   for (; (s_c + this->win) < n_sites; s_c++)
+/* Start the additional threads of the element sweep. Each gets its own copy
+   of the data object with its own kernel buffers. If a thread can not be
+   started, the remaining ones pick up its work. */
+static int
+scmf_rna_opt_start_workers (const unsigned long n, Scmf_Rna_Opt_data* this)
+{
+   unsigned long t;
+   unsigned long scratch_size;
+   ScmfElemWorker* w;
+
+   scratch_size = scmf_rna_opt_int_scratch_size (alphabet_size (this->sigma));
+
+   this->thr_scratch = XMALLOC (n * scratch_size
+                                * sizeof (*(this->thr_scratch)));
+   this->workers = XMALLOC (n * sizeof (*(this->workers)));
+   this->queue = XMALLOC (sizeof (*(this->queue)));
+   if (  (this->thr_scratch == NULL) || (this->workers == NULL)
+       || (this->queue == NULL))
    {
-      het += seqmatrix_get_probability (state, (s_c + this->win), sm);
-      if (s_c % 2 == 0) {/* SBhet 30-12-09 */
-      seqmatrix_add_2_eeff (((het - seqmatrix_get_probability (state, s_c, sm))
-                             / (this->win + this->win)) 
-                            * this->het_scale, state, s_c, sm);
-      }/* SBhet 30-12-09 */
-      het -= seqmatrix_get_probability (state, (s_c - this->win), sm);
+      XFREE (this->queue);
+      this->queue = NULL;
+      scmf_rna_opt_stop_workers (this);
+      return 1;
    }
 
-   /* shrink window until last pos */
-   for (; s_c < n_sites; s_c++)
+   this->queue->list   = NULL;
+   this->queue->n      = 0;
+   this->queue->next   = 0;
+   this->queue->round  = 0;
+   this->queue->active = 0;
+   this->queue->stop   = false;
+   pthread_mutex_init (&(this->queue->lock), NULL);
+   pthread_cond_init (&(this->queue->start), NULL);
+   pthread_cond_init (&(this->queue->done), NULL);
+
+   for (t = 0; t < n; t++)
    {
-      if (s_c % 2 == 0) {/* SBhet 30-12-09 */
-      seqmatrix_add_2_eeff (((het - seqmatrix_get_probability (state, s_c, sm))
-                             / ((n_sites - s_c) + this->win - 1)) 
-                            * this->het_scale, state, s_c, sm);
-      }/* SBhet 30-12-09 */
-      het -= seqmatrix_get_probability (state, (s_c - this->win), sm);
+      w = &(this->workers[t]);
+      w->data = *this;
+      w->data.int_scratch = this->thr_scratch + (t * scratch_size);
+      w->data.rec = NULL;
+      w->data.rec_error = 0;
+      w->queue = this->queue;
+      w->round = 0;
+
+      if (pthread_create (&(w->thread), NULL, scmf_rna_opt_elem_worker, w)
+          != 0)
+      {
+         break;
+      }
+      this->n_workers++;
    }
+
+   return 0;
 }
+#endif
 
-static void
-scmf_rna_opt_calc_nun_term (const unsigned long state,
-                            const unsigned long n_sites,
-                            const unsigned long alpha_size,
-                            const Scmf_Rna_Opt_data* this,
-                            SeqMatrix* sm)
+/** @brief Set the number of threads used for evaluating structure elements.
+ *
+ * Structure elements are independent from each other within a step, so they
+ * may be evaluated in parallel. The additional threads are started here and
+ * kept until the number of threads changes or the data object is deleted.
+ * Without POSIX threads support, the number is stored but all elements are
+ * evaluated by the calling thread.\n
+ * Returns 0 on success, 1 if memory for the threads could not be allocated.
+ *
+ * @params[in] n Number of threads, 0 is treated as 1.
+ * @params[in] this Data object.
+ */
+int
+scmf_rna_opt_data_set_threads (unsigned long n, Scmf_Rna_Opt_data* this)
 {
-   unsigned long i;             /* iterates sites */
-   unsigned long n;             /* iterates the alphabet */
-   unsigned long mate;
-   float cell;
-
    assert (this);
-   assert (this->scores);
-   assert (this->rna);
+   assert (this->sigma);
 
-   for (i = 0; i < n_sites; i++)
+   if (n == 0)
    {
-      mate = rna_base_pairs_with (i, this->rna);
-      if (mate != NOT_PAIRED)
-      {
-         cell = 0.0f;
-         for (n = 0; n < alpha_size; n++)
-         {
-            cell += (seqmatrix_get_probability(n, mate, sm) 
-                     * nn_scores_get_nun_penalty (n, state, this->scores));
-         }
-         /* add to Eeff */
-         seqmatrix_add_2_eeff (cell, state, i, sm);
-      }
+      n = 1;
+   }
+
+   if (n == this->n_threads)
+   {
+      return 0;
+   }
+
+#ifdef HAVE_PTHREAD
+   scmf_rna_opt_stop_workers (this);
+   this->n_threads = 1;
+
+   if ((n > 1) && scmf_rna_opt_start_workers (n - 1, this))
+   {
+      return 1;
    }
+#endif
+
+   this->n_threads = n;
+
+   return 0;
 }
 
 /** @brief SCMF simulation function.
@@ -2687,14 +3415,13 @@ scmf_rna_opt_calc_col_nn (SeqMatrix* sm,
    unsigned long i;
    unsigned long n_states;
    unsigned long n_sites;
-   unsigned long r, c;
+   unsigned long r, c, e;
    /* unsigned long pi, c_neg, abp; */
    /* char b_i, b_ip, b_jm, b_j; */
    float cell;
    /* float prob; */
    unsigned long allowed_bp;
    unsigned long alpha_size;
-   SecStruct* structure;
 
    assert (sm);
    assert (sco);
@@ -2704,62 +3431,68 @@ scmf_rna_opt_calc_col_nn (SeqMatrix* sm,
    allowed_bp = nn_scores_no_allowed_basepairs (this->scores);
    alpha_size = alphabet_size (this->sigma);
 
-   seqmatrix_set_eeff_matrix_zero (sm);
-
    /* iterate all bases (n_states) */
    n_states = seqmatrix_get_rows (sm);
    n_sites = seqmatrix_get_width (sm);
    r = 0;
-   structure = rna_get_secstruct(this->rna);
-   /* seqmatrix_print_2_stdout (2, sm); */ /* SB 300409*/
-   while ((r < n_states) && (!error))
-   {
-      /*seqmatrix_print_2_stdout (2, sm);*/
-      /* process structure components */
-      /* external loop */
-      scmf_rna_opt_calc_ext_loop (r, alpha_size, allowed_bp, sm, this);
 
-      /* stacking pairs */
-      n = secstruct_get_noof_stacks (structure);
-      for (i = 0; i < n; i++)
+   /* process structure components, only elements whose columns changed by
+      more than the tolerance since their last calculation are
+      recalculated */
+   n = 0;
+   for (e = 0; e < this->n_elems; e++)
+   {
+      if (scmf_rna_opt_elem_is_dirty (e, sm, this))
       {
-         scmf_rna_opt_calc_stack (r, i, allowed_bp, sm, this);
+         this->dirty[n].elem = e;
+         n++;
       }
+   }
 
-      /* bulge loops */
-      n = secstruct_get_noof_bulges (structure);
+#ifdef HAVE_PTHREAD
+   if ((this->n_workers > 0) && (n > 1))
+   {
+      scmf_rna_opt_sweep_elems_parallel (n, alpha_size, allowed_bp, sm, this);
+   }
+   else
+#endif
+   {
       for (i = 0; i < n; i++)
       {
-         scmf_rna_opt_calc_bulge (r, i, allowed_bp, sm, this);
+         scmf_rna_opt_calc_elem (this->dirty[i].elem, alpha_size, allowed_bp,
+                                 sm, this);
       }
+   }
 
-      /* internal loops */
-      n = secstruct_get_noof_internals (structure);
-      for (i = 0; i < n; i++)
-      {
-         scmf_rna_opt_calc_internals (r, i, alpha_size, allowed_bp, sm, this);
-      }      
-
-      /* hairpin loops */
-      n = secstruct_get_noof_hairpins (structure);
-      for (i = 0; i < n; i++)
-      {
-         scmf_rna_opt_calc_hairpin (r, i, alpha_size, allowed_bp, sm, this);
-      }
+   if (this->rec_error)
+   {
+      return 1;
+   }
 
-      /* multiloops */
-      n = secstruct_get_noof_multiloops (structure);
-      for (i = 0; i < n; i++)
+   /* collect contributions of all elements */
+   seqmatrix_set_eeff_matrix_zero (sm);
+   seqmatrix_reset_col_change (sm);
+   for (e = 0; e < this->n_elems; e++)
+   {
+      for (i = 0; i < ARRAY_CURRENT(this->elem_cache[e]); i++)
       {
-         scmf_rna_opt_calc_multi_loop (r, i, alpha_size, allowed_bp, sm, this);
+         seqmatrix_add_2_eeff (ARRAY_ACCESS(this->elem_cache[e], i).value,
+                               ARRAY_ACCESS(this->elem_cache[e], i).row,
+                               ARRAY_ACCESS(this->elem_cache[e], i).col,
+                               sm);
       }
+   }
 
-      /* calc. neg. design term, iteratevily */
-      scmf_rna_opt_calc_neg_loop (r, n_sites, allowed_bp, alpha_size, this, sm);
+   /* seqmatrix_print_2_stdout (2, sm); */ /* SB 300409*/
+   /* calc. neg. design term, for all states at once */
+   scmf_rna_opt_calc_neg_design (n_sites, allowed_bp, alpha_size, this, sm);
 
-      /* heterogenity term */
-      scmf_rna_opt_calc_het_term (r, n_sites, this, sm);
+   r = 0;
+   /* heterogenity term, for all states at once */
+   scmf_rna_opt_calc_het_terms (n_sites, alpha_size, this, sm);
 
+   while ((r < n_states) && (!error))
+   {
       /* nun term */
       scmf_rna_opt_calc_nun_term (r, n_sites, alpha_size, this, sm);
 
@@ -55,6 +55,9 @@ extern "C" {
 
 typedef struct Scmf_Rna_Opt_data Scmf_Rna_Opt_data;
 
+/* span of unwanted pairs in the negative design term covering all pairs */
+#define SCMF_RNA_OPT_NEG_SPAN_ALL ((unsigned long) -1)
+
 Scmf_Rna_Opt_data*
 scmf_rna_opt_data_new (const char*, const int);
 
@@ -83,7 +86,7 @@ int
 scmf_rna_opt_data_secstruct_init (Scmf_Rna_Opt_data*);
 
 int
-scmf_rna_opt_data_update_neg_design_energy (void*, unsigned long, SeqMatrix*);
+scmf_rna_opt_data_set_threads (unsigned long, Scmf_Rna_Opt_data*);
 
 int
 scmf_rna_opt_data_init_negative_design_energies_alt (void*,
@@ -106,6 +109,12 @@ scmf_rna_opt_data_set_bp_allowed (char**, Scmf_Rna_Opt_data*);
 void
 scmf_rna_opt_data_set_het_window (const long, Scmf_Rna_Opt_data*);
 
+void
+scmf_rna_opt_data_set_neg_span (const unsigned long, Scmf_Rna_Opt_data*);
+
+void
+scmf_rna_opt_data_set_dirty_tolerance (const float, Scmf_Rna_Opt_data*);
+
 Alphabet*
 scmf_rna_opt_data_get_alphabet (Scmf_Rna_Opt_data*);
 
@@ -118,6 +127,12 @@ scmf_rna_opt_data_get_seq_sm (void* data);
 unsigned long
 scmf_rna_opt_data_get_rna_size (Scmf_Rna_Opt_data*);
 
+Rna*
+scmf_rna_opt_data_get_rna (Scmf_Rna_Opt_data*);
+
+int
+scmf_rna_opt_data_init_nussinov_aggregates (void*, SeqMatrix*);
+
 float
 scmf_rna_opt_calc_nussinov (const unsigned long, const unsigned long,
                            void*,
@@ -66,6 +66,7 @@ struct SeqMatrix {
    char* fixed_sites;          /* list of fixed sites in the matrix */
    float** prob_m;             /* probability matrix */
    float** calc_m;             /* matrix for calculation of new prob. */
+   float* col_change;          /* max. change of prob. per col. since reset */
    size_t rows;
    size_t cols;
    float gas_constant;
@@ -121,6 +122,7 @@ seqmatrix_new (const char* file, const int line)
       sm->get_seq_string    = NULL;
       sm->prob_m            = NULL;
       sm->calc_m            = NULL;
+      sm->col_change        = NULL;
       sm->gas_constant  = 1;
    }
 
@@ -143,6 +145,7 @@ seqmatrix_delete (SeqMatrix* sm)
       XFREE    (sm->fixed_sites);
       XFREE_2D ((void**)sm->prob_m);
       XFREE_2D ((void**)sm->calc_m);
+      XFREE    (sm->col_change);
 
 /*       for (i = 0; i < No_Of_Mtrx; i++) */
 /*       { */
@@ -247,6 +250,26 @@ seqmatrix_get_eeff (const unsigned long row, const unsigned long col,
    return sm->calc_m[row][col];
 }
 
+/** @brief Get the change of a column since the last reset.
+ *
+ * Returns the largest absolute change of a probability in a certain column
+ * since the last call of @c seqmatrix_reset_col_change(). Columns which were
+ * fixed in the meantime report a change of 1. After initialisation, all
+ * columns are reported as changed.
+ *
+ * @params[in] col Column.
+ * @params[in] sm Sequence matrix.
+ */
+float
+seqmatrix_get_col_change (const unsigned long col, const SeqMatrix* sm)
+{
+   assert (sm);
+   assert (sm->col_change);
+   assert (col < sm->cols);
+
+   return sm->col_change[col];
+}
+
 /** @brief Get the gas constant.
  *
  * @params[in] sm Sequence matrix
@@ -278,6 +301,27 @@ seqmatrix_set_eeff_matrix_zero (SeqMatrix* sm)
                                    sizeof (**(sm->calc_m)));
 }
 
+/** @brief Reset the change of all columns to 0.
+ *
+ * Intended to be called by an Eeff function after it has inspected which
+ * columns changed since its last call.
+ *
+ * @param[in] sm sequence matrix.
+ */
+void
+seqmatrix_reset_col_change (SeqMatrix* sm)
+{
+   unsigned long i;
+
+   assert (sm);
+   assert (sm->col_change);
+
+   for (i = 0; i < sm->cols; i++)
+   {
+      sm->col_change[i] = 0.0f;
+   }
+}
+
 /** @brief Switch the currently enabled matrix.
  *
  * For use when writing large parts of the simulation on your own. Switches the matrix whose values are accessible/ editable
@@ -323,10 +367,88 @@ seqmatrix_fix_col (const unsigned long row, const unsigned long col,
    /* set demand to 1 */
    sm->prob_m[row][col] = 1.0f;
    sm->calc_m[row][col] = 1.0f;
+   sm->col_change[col] = 1.0f;
 
    return sm->fixing_site_hook (data, i, sm);
 }
 
+/** @brief Freeze a certain column in a sequence matrix.
+ *
+ * Marks a column as fixed without touching its probabilities. Frozen columns
+ * are neither updated nor evaluated during a simulation, until released by
+ * seqmatrix_unfreeze_col(). Meant for staging simulations on parts of a
+ * matrix.
+ *
+ * @param[in] col column to be frozen.
+ * @param[in] sm sequence matrix.
+ */
+void
+seqmatrix_freeze_col (const unsigned long col, SeqMatrix* sm)
+{
+   assert (sm);
+   assert (sm->fixed_sites);
+   assert (col < sm->cols);
+
+   sm->fixed_sites[(col / CHAR_BIT)] = 
+      (char) (sm->fixed_sites[(col / CHAR_BIT)] | (1 << (col % CHAR_BIT)));
+}
+
+/** @brief Release a frozen column in a sequence matrix.
+ *
+ * Releases a column frozen by seqmatrix_freeze_col(). Do not use on columns
+ * fixed by seqmatrix_fix_col().
+ *
+ * @param[in] col column to be released.
+ * @param[in] sm sequence matrix.
+ */
+void
+seqmatrix_unfreeze_col (const unsigned long col, SeqMatrix* sm)
+{
+   assert (sm);
+   assert (sm->fixed_sites);
+   assert (col < sm->cols);
+
+   sm->fixed_sites[(col / CHAR_BIT)] = 
+      (char) (sm->fixed_sites[(col / CHAR_BIT)] & ~(1 << (col % CHAR_BIT)));
+   sm->col_change[col] = 1.0f;
+}
+
+/** @brief Preset the probabilities of a column in a sequence matrix.
+ *
+ * Sets a certain cell of a sequence matrix to a probability and distributes
+ * the rest evenly over the other rows of the column. In contrast to
+ * seqmatrix_fix_col(), the column stays open for the simulation. Use this
+ * to start a simulation from a known sequence instead of an even
+ * distribution.
+ *
+ * @param[in] row row to be preset.
+ * @param[in] col column to be preset.
+ * @param[in] prob probability of the row.
+ * @param[in] sm sequence matrix.
+ */
+void
+seqmatrix_preset_col (const unsigned long row, const unsigned long col,
+                      const float prob, SeqMatrix* sm)
+{
+   unsigned long i;
+   float rest;
+
+   assert (sm);
+   assert (sm->prob_m);
+   assert (col < sm->cols);
+   assert (row < sm->rows);
+   assert (sm->rows > 1);
+   assert ((prob >= 0.0f) && (prob <= 1.0f));
+
+   rest = (1.0f - prob) / (sm->rows - 1);
+   for (i = 0; i < sm->rows; i++)
+   {
+      sm->prob_m[i][col] = rest;
+   }
+   sm->prob_m[row][col] = prob;
+   sm->col_change[col] = 1.0f;
+}
+
 static __inline__ int
 seqmatrix_pre_col_iter_hook (void* data, SeqMatrix* sm)
 {
@@ -466,6 +588,7 @@ seqmatrix_init (const unsigned long rows,
    assert (sm->fixed_sites == NULL);
    assert (sm->prob_m      == NULL);
    assert (sm->calc_m      == NULL);
+   assert (sm->col_change  == NULL);
 
    /* set standard functions */
    sm->calc_eeff_col     = seqmatrix_calc_eeff_col_scmf;
@@ -495,6 +618,17 @@ seqmatrix_init (const unsigned long rows,
       return ERR_SM_ALLOC;
    }
 
+   sm->col_change = XOBJ_MALLOC (sm->cols * sizeof (*sm->col_change),
+                                 file, line);
+   if (sm->col_change == NULL)
+   {
+      return ERR_SM_ALLOC;
+   }
+   for (i = 0; i < width; i++)
+   {
+      sm->col_change[i] = 1.0f;  /* nothing calculated so far */
+   }
+
    /* init sm */
    if (width > 0)
    {
@@ -1005,6 +1139,7 @@ seqmatrix_simulate_scmf (const unsigned long steps,
    int error= 0;
    unsigned long i, j;          /* iterator */
    float col_sum;
+   float p_old, delta;
    float T = t_init;            /* current temperature */
    float c_rate = 0.999999f;/* SB 090715 for testing 1.0f; *//* cooling rate */
    float s_cur/* , s_last */;         /* matrix entropy */
@@ -1108,10 +1243,18 @@ seqmatrix_simulate_scmf (const unsigned long steps,
                   sm->calc_m[i][j] = sm->calc_m[i][j] / col_sum;  
 
                   /* avoid oscilation by Pnew = uPcomp + (1 - u)Pold) */
+                  p_old = sm->prob_m[i][j];
                   sm->prob_m[i][j] = 
                      (lambda * sm->calc_m[i][j])
                      + ((1 - lambda) * sm->prob_m[i][j]);
 
+                  /* track changes for incremental Eeff functions */
+                  delta = fabsf (sm->prob_m[i][j] - p_old);
+                  if (delta > sm->col_change[j])
+                  {
+                     sm->col_change[j] = delta;
+                  }
+
                   if (sm->prob_m[i][j] > 0.99f)
                   {
                      seqmatrix_fix_col (i, j, sco, sm);
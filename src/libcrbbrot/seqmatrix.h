@@ -87,6 +87,9 @@ float
 seqmatrix_get_eeff (const unsigned long, const unsigned long,
                     const SeqMatrix*);
 
+float
+seqmatrix_get_col_change (const unsigned long, const SeqMatrix*);
+
 float
 seqmatrix_get_gas_constant (const SeqMatrix*);
 
@@ -105,6 +108,9 @@ seqmatrix_init (const unsigned long,
 void
 seqmatrix_set_eeff_matrix_zero (SeqMatrix*);
 
+void
+seqmatrix_reset_col_change (SeqMatrix*);
+
 void
 seqmatrix_set_eeff (const float,
                     const unsigned long,
@@ -169,6 +175,18 @@ seqmatrix_fix_col (const unsigned long,
                    void*,
                    SeqMatrix*);
 
+void
+seqmatrix_freeze_col (const unsigned long, SeqMatrix*);
+
+void
+seqmatrix_unfreeze_col (const unsigned long, SeqMatrix*);
+
+void
+seqmatrix_preset_col (const unsigned long,
+                      const unsigned long,
+                      const float,
+                      SeqMatrix*);
+
 int
 seqmatrix_simulate_scmf (unsigned long,
                          const float,
@@ -46,6 +46,7 @@
 extern "C" {
 #endif
 
+#include <libcrbbasic/rng.h>
 #include "alphabet.h"
 
 #ifndef NN_SCORES_H
@@ -66,6 +67,8 @@ enum dangle_indices {
 };
 
 typedef struct NN_scores NN_scores;
+
+typedef struct NN_int_scores NN_int_scores;
    
 
 /**********************   Constructors and destructors   **********************/
@@ -80,18 +83,61 @@ nn_scores_new_init (float, Alphabet*, const char*, const int);
 
 #define NN_SCORES_NEW_INIT(A, B) nn_scores_new_init (A, B, __FILE__, __LINE__)
 
+NN_scores*
+nn_scores_new_from_file (const char*, float, Alphabet*, const char*, const int);
+
+#define NN_SCORES_NEW_FROM_FILE(P, A, B) \
+   nn_scores_new_from_file (P, A, B, __FILE__, __LINE__)
+
+NN_scores*
+nn_scores_new_copy (const NN_scores*, const float, const char*, const int);
+
+#define NN_SCORES_NEW_COPY(S, A) nn_scores_new_copy (S, A, __FILE__, __LINE__)
+
+NN_scores*
+nn_scores_new_noisy_copy (const NN_scores*, const float, const Rng*,
+                          const char*, const int);
+
+#define NN_SCORES_NEW_NOISY_COPY(S, A, R) \
+   nn_scores_new_noisy_copy (S, A, R, __FILE__, __LINE__)
+
+NN_scores*
+nn_scores_new_at_temperature (const NN_scores*, const NN_scores*, const float,
+                              const char*, const int);
+
+#define NN_SCORES_NEW_AT_TEMPERATURE(S, H, T) \
+   nn_scores_new_at_temperature (S, H, T, __FILE__, __LINE__)
+
+const NN_scores*
+nn_scores_at_temperature (const NN_scores*, const NN_scores*, const float);
+
+void
+nn_scores_at_temperature_release (const NN_scores*);
+
 void
 nn_scores_delete (NN_scores*);
 
+NN_int_scores*
+nn_int_scores_new (const NN_scores*, const unsigned long, const char*,
+                   const int);
+
+#define NN_INT_SCORES_NEW(S, M) nn_int_scores_new (S, M, __FILE__, __LINE__)
+
+void
+nn_int_scores_delete (NN_int_scores*);
+
 
 /********************************   Altering   ********************************/
 
 void
-nn_scores_add_thermal_noise (unsigned long, long int seedval, NN_scores*);
+nn_scores_add_thermal_noise (unsigned long, const Rng*, NN_scores*);
 
 
 /*********************************   Access   *********************************/
 
+float
+nn_scores_get_temperature (const NN_scores*);
+
 unsigned long
 nn_scores_get_size_tetra_loop (const NN_scores*);
 
@@ -177,6 +223,12 @@ nn_scores_get_G_internal_2x2_loop (const int,
                                    const int,
                                    const NN_scores*);
 
+void
+nn_scores_get_G_internal_2x2_loop_n (const char*,
+                                     const unsigned long,
+                                     float*,
+                                     const NN_scores*);
+
 float
 nn_scores_get_G_internal_1x2_loop (const int,
                                    const int,
@@ -187,6 +239,12 @@ nn_scores_get_G_internal_1x2_loop (const int,
                                    const int,
                                    const NN_scores*);
 
+void
+nn_scores_get_G_internal_1x2_loop_n (const char*,
+                                     const unsigned long,
+                                     float*,
+                                     const NN_scores*);
+
 float
 nn_scores_get_G_internal_1x1_loop (const int,
                                    const int,
@@ -196,6 +254,12 @@ nn_scores_get_G_internal_1x1_loop (const int,
                                    const int,
                                    const NN_scores*);
 
+void
+nn_scores_get_G_internal_1x1_loop_n (const char*,
+                                     const unsigned long,
+                                     float*,
+                                     const NN_scores*);
+
 float
 nn_scores_get_G_mismatch_interior (const int,
                                    const int,
@@ -217,6 +281,45 @@ float
 nn_scores_get_G_mm_stack (const char, const char, const char, const char,
                           const NN_scores*);
 
+int
+nn_int_scores_get_G_stack (const int, const int, const int, const int,
+                           const NN_int_scores*);
+
+int
+nn_int_scores_get_G_extloop_multiloop (const char*,
+                                       const unsigned long,
+                                       const unsigned long,
+                                       unsigned long (*stems)[No_Of_Strands],
+                                       const unsigned long,
+                                       unsigned long (*dangle5)[No_Of_Dangles],
+                                       const unsigned long,
+                                       unsigned long (*dangle3)[No_Of_Dangles],
+                                       const bool,
+                                       const NN_int_scores*);
+
+int
+nn_int_scores_get_G_hairpin_loop (const char*,
+                                  const unsigned long,
+                                  const unsigned long,
+                                  const unsigned long,
+                                  const NN_int_scores*);
+
+int
+nn_int_scores_get_G_bulge_loop (const int, const int,
+                                const int, const int,
+                                const unsigned long,
+                                const NN_int_scores*);
+
+int
+nn_int_scores_get_G_internal_loop (const char*,
+                                   const unsigned long,
+                                   const unsigned long,
+                                   const unsigned long,
+                                   const unsigned long,
+                                   const unsigned long,
+                                   const unsigned long,
+                                   const NN_int_scores*);
+
 /*********************************    Size    *********************************/
 
 unsigned long
@@ -256,11 +359,6 @@ nn_scores_fprintf_non_gc_penalty_for_bp(FILE*,
                                         const NN_scores*,
                                         const Alphabet*);
 
-void
-nn_scores_fprintf_tetra_loop_hashfunction(FILE*,
-                                          const NN_scores*,
-                                          const Alphabet*);
-
 void
 nn_scores_fprintf_tetra_loop(FILE*, const NN_scores*, const Alphabet*);
 
@@ -287,6 +385,14 @@ nn_scores_fprintf_G_int21 (FILE*, const NN_scores*, const Alphabet*);
 void
 nn_scores_fprintf_G_int22 (FILE*, const NN_scores*, const Alphabet*);
 
+void
+nn_scores_fprintf_par (FILE*, const NN_scores*, const Alphabet*);
+
+#ifdef NN_SCORES_GEN
+int
+nn_scores_fprintf_default (FILE*, const NN_scores*, const Alphabet*);
+#endif
+
 /******************************   Miscellaneous   *****************************/
 
 unsigned long
@@ -0,0 +1,2199 @@
+/* Standard parameters of the Nearest Neighbour model in the layout of
+   the tables of NN_scores for the alphabet "ACGU". Generated by nn_scores_gen,
+   do not edit. */
+
+#define NN_DEFAULT_ALPHA_SIZE 4UL
+
+static const char nn_default_base_no[4] = { 0, 1, 2, 3 };
+
+static const char nn_default_00[12] = {
+   1, 2, 2, 1, 2, 3, 3, 2,
+   0, 3, 3, 0,
+};
+
+static const char nn_default_01[16] = {
+   6, 8, 7, 4, 13, 15, 0, 14,
+   11, 1, 12, 2, 5, 10, 3, 9,
+};
+
+static const float nn_default_02[16] = {
+   65.0f, 65.0f, 65.0f, 0.0f, 65.0f, 65.0f, 0.0f, 65.0f,
+   65.0f, 0.0f, 65.0f, 0.0f, 0.0f, 65.0f, 0.0f, 65.0f,
+};
+
+/* stack */
+static const float nn_default_03[36] = {
+   -240.0f, -330.0f, -210.0f, -140.0f, -210.0f, -210.0f, -330.0f, -340.0f,
+   -250.0f, -150.0f, -220.0f, -240.0f, -210.0f, -250.0f, 130.0f, -50.0f,
+   -140.0f, -130.0f, -140.0f, -150.0f, -50.0f, 30.0f, -60.0f, -100.0f,
+   -210.0f, -220.0f, -140.0f, -60.0f, -110.0f, -90.0f, -210.0f, -240.0f,
+   -130.0f, -100.0f, -90.0f, -130.0f,
+};
+
+/* mismatch_stack */
+static const float nn_default_04[96] = {
+   -145.0f, -100.0f, -55.0f, -90.0f, -90.0f, -85.0f, -75.0f, -125.0f,
+   -75.0f, -135.0f, -70.0f, -165.0f, -80.0f, -50.0f, -40.0f, -45.0f,
+   -120.0f, -145.0f, -60.0f, -110.0f, -105.0f, -95.0f, -55.0f, -120.0f,
+   -75.0f, -110.0f, -50.0f, -175.0f, -70.0f, -55.0f, -25.0f, -35.0f,
+   -40.0f, -20.0f, 35.0f, 15.0f, 20.0f, 20.0f, 45.0f, -35.0f,
+   10.0f, -55.0f, 20.0f, -65.0f, 20.0f, 30.0f, 25.0f, 25.0f,
+   -50.0f, -25.0f, 0.0f, 5.0f, 10.0f, 5.0f, 10.0f, -50.0f,
+   20.0f, -40.0f, 30.0f, -60.0f, 20.0f, 25.0f, 35.0f, 30.0f,
+   -40.0f, -25.0f, 45.0f, 5.0f, 20.0f, 20.0f, 20.0f, -35.0f,
+   10.0f, -55.0f, 20.0f, -75.0f, 25.0f, 30.0f, 25.0f, 25.0f,
+   -25.0f, -25.0f, 25.0f, 10.0f, 10.0f, 20.0f, 10.0f, -50.0f,
+   20.0f, -40.0f, 30.0f, -90.0f, 0.0f, 25.0f, 35.0f, 30.0f,
+};
+
+/* hairpin */
+static const float nn_default_05[31] = {
+   3.40282347e+38f, 3.40282347e+38f, 3.40282347e+38f, 570.0f, 560.0f, 560.0f, 540.0f, 590.0f,
+   560.0f, 640.0f, 650.0f, 660.0f, 670.0f, 678.0f, 686.0f, 694.0f,
+   701.0f, 707.0f, 713.0f, 719.0f, 725.0f, 730.0f, 735.0f, 740.0f,
+   744.0f, 749.0f, 753.0f, 757.0f, 761.0f, 765.0f, 769.0f,
+};
+
+/* mismatch_hairpin */
+static const float nn_default_06[96] = {
+   -150.0f, -150.0f, -140.0f, -180.0f, -100.0f, -90.0f, -290.0f, -80.0f,
+   -220.0f, -200.0f, -160.0f, -110.0f, -170.0f, -140.0f, -180.0f, -200.0f,
+   -110.0f, -150.0f, -130.0f, -210.0f, -110.0f, -70.0f, -240.0f, -50.0f,
+   -240.0f, -290.0f, -140.0f, -120.0f, -190.0f, -100.0f, -220.0f, -150.0f,
+   20.0f, -50.0f, -30.0f, -30.0f, -10.0f, -20.0f, -150.0f, -20.0f,
+   -90.0f, -110.0f, -30.0f, 0.0f, -30.0f, -30.0f, -40.0f, -110.0f,
+   -50.0f, -30.0f, -60.0f, -50.0f, -20.0f, -10.0f, -170.0f, 0.0f,
+   -80.0f, -120.0f, -30.0f, -70.0f, -60.0f, -10.0f, -60.0f, -80.0f,
+   -30.0f, -50.0f, -30.0f, -30.0f, -10.0f, -20.0f, -150.0f, -20.0f,
+   -110.0f, -120.0f, -20.0f, 20.0f, -30.0f, -30.0f, -60.0f, -110.0f,
+   -50.0f, -30.0f, -60.0f, -50.0f, -20.0f, -10.0f, -120.0f, 0.0f,
+   -140.0f, -120.0f, -70.0f, -20.0f, -30.0f, -10.0f, -50.0f, -80.0f,
+};
+
+/* bulge */
+static const float nn_default_07[31] = {
+   3.40282347e+38f, 380.0f, 280.0f, 320.0f, 360.0f, 400.0f, 440.0f, 459.0f,
+   470.0f, 480.0f, 490.0f, 500.0f, 510.0f, 519.0f, 527.0f, 534.0f,
+   541.0f, 548.0f, 554.0f, 560.0f, 565.0f, 571.0f, 576.0f, 580.0f,
+   585.0f, 589.0f, 594.0f, 598.0f, 602.0f, 605.0f, 609.0f,
+};
+
+/* non_gc_penalty */
+static const float nn_default_08[6] = {
+   0.0f, 0.0f, 50.0f, 50.0f, 50.0f, 50.0f,
+};
+
+static const char nn_default_09[210] = {
+   0, 2, 0, 0, 0, 3, 0, 0,
+   2, 1, 0, 0, 3, 0, 0, 2,
+   3, 0, 0, 3, 0, 0, 2, 3,
+   2, 0, 3, 0, 1, 2, 0, 0,
+   0, 2, 0, 1, 2, 0, 0, 2,
+   2, 0, 1, 2, 0, 2, 0, 2,
+   0, 1, 2, 1, 0, 0, 2, 0,
+   1, 2, 1, 2, 0, 2, 0, 1,
+   2, 2, 0, 0, 2, 0, 1, 2,
+   2, 2, 0, 2, 0, 1, 2, 3,
+   0, 0, 2, 0, 1, 2, 3, 2,
+   0, 2, 0, 1, 3, 0, 0, 1,
+   2, 0, 1, 3, 0, 1, 2, 2,
+   0, 1, 3, 3, 1, 2, 2, 0,
+   2, 2, 0, 0, 0, 1, 0, 2,
+   2, 0, 0, 2, 1, 0, 2, 2,
+   0, 2, 0, 1, 0, 2, 2, 1,
+   0, 0, 1, 0, 2, 2, 1, 2,
+   0, 1, 0, 2, 2, 2, 0, 0,
+   1, 0, 2, 2, 2, 0, 2, 1,
+   0, 2, 2, 2, 2, 0, 1, 0,
+   2, 2, 3, 2, 0, 1, 0, 2,
+   3, 2, 0, 0, 1, 0, 3, 2,
+   0, 0, 0, 0, 0, 3, 2, 0,
+   0, 0, 2, 0, 3, 2, 0, 2,
+   0, 2, 0, 3, 2, 2, 0, 0,
+   0, 0,
+};
+
+static const float nn_default_10[4096] = {
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, -200.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -200.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -200.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -200.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -300.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -150.0f, 0.0f, -200.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, -250.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -150.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+};
+
+/* dangle5 */
+static const float nn_default_11[24] = {
+   -50.0f, -30.0f, -20.0f, -10.0f, -20.0f, -30.0f, 0.0f, 0.0f,
+   -30.0f, -30.0f, -40.0f, -20.0f, -30.0f, -10.0f, -20.0f, -20.0f,
+   -30.0f, -30.0f, -40.0f, -20.0f, -30.0f, -10.0f, -20.0f, -20.0f,
+};
+
+/* dangle3 */
+static const float nn_default_12[24] = {
+   -110.0f, -40.0f, -130.0f, -60.0f, -170.0f, -80.0f, -170.0f, -120.0f,
+   -70.0f, -10.0f, -70.0f, -10.0f, -80.0f, -50.0f, -80.0f, -60.0f,
+   -70.0f, -10.0f, -70.0f, -10.0f, -80.0f, -50.0f, -80.0f, -60.0f,
+};
+
+/* interior */
+static const float nn_default_13[31] = {
+   3.40282347e+38f, 3.40282347e+38f, 410.0f, 510.0f, 170.0f, 180.0f, 200.0f, 220.0f,
+   230.0f, 240.0f, 250.0f, 260.0f, 270.0f, 278.0f, 286.0f, 294.0f,
+   301.0f, 307.0f, 313.0f, 319.0f, 325.0f, 330.0f, 335.0f, 340.0f,
+   345.0f, 349.0f, 353.0f, 357.0f, 361.0f, 365.0f, 369.0f,
+};
+
+/* int11 */
+static const float nn_default_14[576] = {
+   110.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f,
+   40.0f, 40.0f, -140.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f,
+   40.0f, -40.0f, 40.0f, 40.0f, 30.0f, 50.0f, 40.0f, 50.0f,
+   -10.0f, 40.0f, -170.0f, 40.0f, 40.0f, 0.0f, 40.0f, -30.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   40.0f, 30.0f, -10.0f, 40.0f, -40.0f, 50.0f, 40.0f, 0.0f,
+   40.0f, 40.0f, -170.0f, 40.0f, 40.0f, 50.0f, 40.0f, -30.0f,
+   80.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f, 40.0f,
+   40.0f, 40.0f, -210.0f, 40.0f, 40.0f, 40.0f, 40.0f, -70.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 100.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 100.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 120.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 150.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   110.0f, 110.0f, -100.0f, 110.0f, 110.0f, 110.0f, 110.0f, 110.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 150.0f,
+   170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f, 170.0f,
+   170.0f, 170.0f, -40.0f, 170.0f, 170.0f, 170.0f, 170.0f, 180.0f,
+};
+
+/* int21 */
+static const float nn_default_15[2304] = {
+   240.0f, 220.0f, 160.0f, 400.0f, 210.0f, 170.0f, 160.0f, 400.0f,
+   100.0f, 60.0f, 40.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   230.0f, 220.0f, 400.0f, 220.0f, 220.0f, 250.0f, 400.0f, 220.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 250.0f, 190.0f, 400.0f, 220.0f,
+   170.0f, 400.0f, 80.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   80.0f, 400.0f, 220.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 220.0f, 400.0f, 130.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 170.0f, 400.0f, 120.0f,
+   230.0f, 220.0f, 110.0f, 400.0f, 210.0f, 170.0f, 160.0f, 400.0f,
+   80.0f, 60.0f, 40.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   230.0f, 220.0f, 400.0f, 220.0f, 220.0f, 250.0f, 400.0f, 220.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 250.0f, 190.0f, 400.0f, 220.0f,
+   170.0f, 400.0f, 80.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   80.0f, 400.0f, 220.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 220.0f, 400.0f, 150.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 170.0f, 400.0f, 120.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   250.0f, 220.0f, 210.0f, 400.0f, 210.0f, 170.0f, 160.0f, 400.0f,
+   120.0f, 60.0f, 40.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   230.0f, 220.0f, 400.0f, 220.0f, 220.0f, 250.0f, 400.0f, 220.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 250.0f, 190.0f, 400.0f, 220.0f,
+   170.0f, 400.0f, 80.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   80.0f, 400.0f, 220.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 220.0f, 400.0f, 120.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 170.0f, 400.0f, 120.0f,
+   240.0f, 220.0f, 160.0f, 400.0f, 210.0f, 170.0f, 160.0f, 400.0f,
+   100.0f, 60.0f, 40.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   230.0f, 220.0f, 400.0f, 220.0f, 220.0f, 250.0f, 400.0f, 220.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 250.0f, 190.0f, 400.0f, 220.0f,
+   170.0f, 400.0f, 80.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   80.0f, 400.0f, 220.0f, 400.0f, 400.0f, 400.0f, 400.0f, 400.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 220.0f, 400.0f, 130.0f,
+   400.0f, 400.0f, 400.0f, 400.0f, 400.0f, 170.0f, 400.0f, 120.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   320.0f, 300.0f, 240.0f, 480.0f, 290.0f, 250.0f, 240.0f, 480.0f,
+   180.0f, 140.0f, 120.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   310.0f, 300.0f, 480.0f, 300.0f, 300.0f, 330.0f, 480.0f, 300.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 330.0f, 270.0f, 480.0f, 300.0f,
+   250.0f, 480.0f, 160.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   160.0f, 480.0f, 300.0f, 480.0f, 480.0f, 480.0f, 480.0f, 480.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 300.0f, 480.0f, 210.0f,
+   480.0f, 480.0f, 480.0f, 480.0f, 480.0f, 250.0f, 480.0f, 200.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+   390.0f, 370.0f, 310.0f, 550.0f, 360.0f, 320.0f, 310.0f, 550.0f,
+   250.0f, 210.0f, 190.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   380.0f, 370.0f, 550.0f, 370.0f, 370.0f, 400.0f, 550.0f, 370.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 400.0f, 340.0f, 550.0f, 370.0f,
+   320.0f, 550.0f, 230.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   230.0f, 550.0f, 370.0f, 550.0f, 550.0f, 550.0f, 550.0f, 550.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 370.0f, 550.0f, 280.0f,
+   550.0f, 550.0f, 550.0f, 550.0f, 550.0f, 320.0f, 550.0f, 270.0f,
+};
+
+/* int22 */
+static const float nn_default_16[9216] = {
+   130.0f, 160.0f, 30.0f, 200.0f, 120.0f, 150.0f, 20.0f, 200.0f,
+   30.0f, 60.0f, -70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 200.0f, 60.0f, 200.0f, 210.0f, 180.0f, 150.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 170.0f, 130.0f, 200.0f,
+   30.0f, 60.0f, -70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 140.0f, 0.0f, 200.0f, -40.0f, -110.0f, -60.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 170.0f, 130.0f, 200.0f,
+   110.0f, 40.0f, 90.0f, 200.0f, 140.0f, 80.0f, 130.0f, 200.0f,
+   120.0f, 210.0f, 200.0f, 190.0f, 110.0f, 140.0f, 200.0f, 120.0f,
+   20.0f, 150.0f, 200.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 180.0f, 200.0f, 170.0f, 140.0f, 170.0f, 200.0f, 150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 120.0f, 150.0f, 200.0f, 140.0f,
+   20.0f, 150.0f, 200.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 180.0f, 200.0f, 170.0f, -150.0f, -20.0f, 200.0f, -40.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 120.0f, 150.0f, 200.0f, 140.0f,
+   0.0f, 130.0f, 200.0f, 110.0f, 30.0f, 60.0f, 200.0f, 50.0f,
+   30.0f, 200.0f, 100.0f, 110.0f, 20.0f, 200.0f, 90.0f, 0.0f,
+   -70.0f, 200.0f, 0.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   60.0f, 200.0f, 140.0f, 40.0f, 150.0f, 200.0f, 180.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 130.0f, 200.0f, 170.0f, 110.0f,
+   -70.0f, 200.0f, 0.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   0.0f, 200.0f, 80.0f, 90.0f, -60.0f, 200.0f, -70.0f, -260.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 130.0f, 200.0f, 170.0f, 110.0f,
+   90.0f, 200.0f, 90.0f, -110.0f, 130.0f, 200.0f, 120.0f, 110.0f,
+   200.0f, 190.0f, -40.0f, 140.0f, 200.0f, 120.0f, -150.0f, 30.0f,
+   200.0f, 130.0f, -60.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 170.0f, -110.0f, 80.0f, 200.0f, 150.0f, -20.0f, 60.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 140.0f, -40.0f, 50.0f,
+   200.0f, 130.0f, -60.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 170.0f, -70.0f, 120.0f, 200.0f, -40.0f, -420.0f, -50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 140.0f, -40.0f, 50.0f,
+   200.0f, 110.0f, -260.0f, 110.0f, 200.0f, 50.0f, -50.0f, -40.0f,
+   50.0f, 60.0f, 0.0f, 200.0f, 110.0f, 150.0f, -70.0f, 200.0f,
+   -30.0f, 10.0f, -160.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 110.0f, -100.0f, 200.0f, 170.0f, 150.0f, -60.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 70.0f, 50.0f, 20.0f, 200.0f,
+   40.0f, 50.0f, -70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 140.0f, 0.0f, 200.0f, 10.0f, -70.0f, -80.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 150.0f, 120.0f, 200.0f,
+   -50.0f, -60.0f, -60.0f, 200.0f, 150.0f, 0.0f, 90.0f, 200.0f,
+   130.0f, 220.0f, 200.0f, 200.0f, 100.0f, 130.0f, 200.0f, 120.0f,
+   -70.0f, 70.0f, 200.0f, 40.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 190.0f, 200.0f, 110.0f, 100.0f, 130.0f, 200.0f, 120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 0.0f, 30.0f, 200.0f, 170.0f,
+   70.0f, 70.0f, 200.0f, 100.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 180.0f, 200.0f, 170.0f, -190.0f, -30.0f, 200.0f, -70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 110.0f, 140.0f, 200.0f, 120.0f,
+   -150.0f, -20.0f, 200.0f, -30.0f, -20.0f, -10.0f, 200.0f, 20.0f,
+   -20.0f, 200.0f, 110.0f, 90.0f, -40.0f, 200.0f, 90.0f, 0.0f,
+   -170.0f, 200.0f, -90.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   70.0f, 200.0f, 80.0f, -10.0f, 110.0f, 200.0f, 150.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 20.0f, 200.0f, 50.0f, 0.0f,
+   -50.0f, 200.0f, -20.0f, 60.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   0.0f, 200.0f, 80.0f, 90.0f, -90.0f, 200.0f, -100.0f, -300.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 120.0f, 200.0f, 150.0f, 100.0f,
+   -130.0f, 200.0f, -60.0f, -240.0f, 90.0f, 200.0f, 110.0f, 60.0f,
+   200.0f, 200.0f, -10.0f, 140.0f, 200.0f, 120.0f, -160.0f, 30.0f,
+   200.0f, 40.0f, -160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 110.0f, -160.0f, 30.0f, 200.0f, 120.0f, -60.0f, 30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 20.0f, -160.0f, 10.0f,
+   200.0f, 50.0f, -60.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 170.0f, -70.0f, 120.0f, 200.0f, -70.0f, -440.0f, -100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 120.0f, -50.0f, 30.0f,
+   200.0f, -10.0f, -410.0f, 10.0f, 200.0f, 40.0f, -100.0f, 60.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 180.0f, 210.0f, 80.0f, 200.0f,
+   80.0f, 110.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 220.0f, 90.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   80.0f, 110.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 170.0f, 30.0f, 200.0f, 60.0f, 0.0f, 40.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   160.0f, 90.0f, 140.0f, 200.0f, 190.0f, 130.0f, 180.0f, 200.0f,
+   190.0f, 280.0f, 200.0f, 270.0f, 170.0f, 200.0f, 200.0f, 180.0f,
+   70.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 210.0f, 200.0f, 190.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   70.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 210.0f, 200.0f, 200.0f, -50.0f, 80.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   50.0f, 180.0f, 200.0f, 160.0f, 80.0f, 110.0f, 200.0f, 100.0f,
+   100.0f, 200.0f, 180.0f, 180.0f, 80.0f, 200.0f, 150.0f, 60.0f,
+   -20.0f, 200.0f, 50.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 160.0f, 70.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   -20.0f, 200.0f, 50.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   30.0f, 200.0f, 110.0f, 110.0f, 40.0f, 200.0f, 40.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   140.0f, 200.0f, 130.0f, -60.0f, 180.0f, 200.0f, 170.0f, 160.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 180.0f, -90.0f, 90.0f,
+   200.0f, 180.0f, -10.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 190.0f, -80.0f, 100.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 180.0f, -10.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, -40.0f, 150.0f, 200.0f, 70.0f, -310.0f, 60.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 160.0f, -210.0f, 160.0f, 200.0f, 100.0f, 0.0f, 10.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 160.0f, 190.0f, 60.0f, 200.0f,
+   100.0f, 130.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 260.0f, 240.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 260.0f, 240.0f, 200.0f, 200.0f,
+   100.0f, 130.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 170.0f, 40.0f, 200.0f, 20.0f, -40.0f, 0.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   150.0f, 80.0f, 130.0f, 200.0f, 220.0f, 150.0f, 200.0f, 200.0f,
+   190.0f, 280.0f, 200.0f, 270.0f, 150.0f, 180.0f, 200.0f, 160.0f,
+   90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 220.0f, 200.0f, 210.0f, 190.0f, 220.0f, 200.0f, 210.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 220.0f, 200.0f, 210.0f,
+   90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 220.0f, 200.0f, 200.0f, -90.0f, 40.0f, 200.0f, 30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   40.0f, 170.0f, 200.0f, 150.0f, 110.0f, 140.0f, 200.0f, 120.0f,
+   100.0f, 200.0f, 180.0f, 180.0f, 60.0f, 200.0f, 130.0f, 40.0f,
+   0.0f, 200.0f, 70.0f, 160.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 180.0f, 80.0f, 200.0f, 200.0f, 240.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 180.0f,
+   0.0f, 200.0f, 70.0f, 160.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   40.0f, 200.0f, 110.0f, 120.0f, 0.0f, 200.0f, 0.0f, -200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   130.0f, 200.0f, 120.0f, -70.0f, 200.0f, 200.0f, 190.0f, 180.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 160.0f, -110.0f, 70.0f,
+   200.0f, 200.0f, 10.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, -70.0f, 120.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 10.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, -30.0f, 150.0f, 200.0f, 30.0f, -350.0f, 20.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 150.0f, -220.0f, 150.0f, 200.0f, 120.0f, 30.0f, 30.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 180.0f, 210.0f, 80.0f, 200.0f,
+   80.0f, 110.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 220.0f, 90.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   80.0f, 110.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 170.0f, 30.0f, 200.0f, 60.0f, 0.0f, 40.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   160.0f, 90.0f, 140.0f, 200.0f, 190.0f, 130.0f, 180.0f, 200.0f,
+   190.0f, 280.0f, 200.0f, 270.0f, 170.0f, 200.0f, 200.0f, 180.0f,
+   70.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 210.0f, 200.0f, 190.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   70.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 210.0f, 200.0f, 200.0f, -50.0f, 80.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   50.0f, 180.0f, 200.0f, 160.0f, 80.0f, 110.0f, 200.0f, 100.0f,
+   100.0f, 200.0f, 180.0f, 180.0f, 80.0f, 200.0f, 150.0f, 60.0f,
+   -20.0f, 200.0f, 50.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 160.0f, 70.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   -20.0f, 200.0f, 50.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   30.0f, 200.0f, 110.0f, 110.0f, 40.0f, 200.0f, 40.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   140.0f, 200.0f, 130.0f, -60.0f, 180.0f, 200.0f, 170.0f, 160.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 180.0f, -90.0f, 90.0f,
+   200.0f, 180.0f, -10.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 190.0f, -80.0f, 100.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 180.0f, -10.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, -40.0f, 150.0f, 200.0f, 70.0f, -310.0f, 60.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 160.0f, -210.0f, 160.0f, 200.0f, 100.0f, 0.0f, 10.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 160.0f, 190.0f, 60.0f, 200.0f,
+   100.0f, 130.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 100.0f, 200.0f, 260.0f, 240.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 260.0f, 240.0f, 200.0f, 200.0f,
+   100.0f, 130.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 170.0f, 40.0f, 200.0f, 20.0f, -40.0f, 0.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 210.0f, 170.0f, 200.0f,
+   150.0f, 80.0f, 130.0f, 200.0f, 220.0f, 150.0f, 200.0f, 200.0f,
+   190.0f, 280.0f, 200.0f, 270.0f, 150.0f, 180.0f, 200.0f, 160.0f,
+   90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 220.0f, 200.0f, 210.0f, 190.0f, 220.0f, 200.0f, 210.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 220.0f, 200.0f, 210.0f,
+   90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 220.0f, 200.0f, 200.0f, -90.0f, 40.0f, 200.0f, 30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 190.0f, 200.0f, 180.0f,
+   40.0f, 170.0f, 200.0f, 150.0f, 110.0f, 140.0f, 200.0f, 120.0f,
+   100.0f, 200.0f, 180.0f, 180.0f, 60.0f, 200.0f, 130.0f, 40.0f,
+   0.0f, 200.0f, 70.0f, 160.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 180.0f, 80.0f, 200.0f, 200.0f, 240.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 180.0f,
+   0.0f, 200.0f, 70.0f, 160.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   40.0f, 200.0f, 110.0f, 120.0f, 0.0f, 200.0f, 0.0f, -200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 210.0f, 150.0f,
+   130.0f, 200.0f, 120.0f, -70.0f, 200.0f, 200.0f, 190.0f, 180.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 160.0f, -110.0f, 70.0f,
+   200.0f, 200.0f, 10.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, -70.0f, 120.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 10.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, -30.0f, 150.0f, 200.0f, 30.0f, -350.0f, 20.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 0.0f, 90.0f,
+   200.0f, 150.0f, -220.0f, 150.0f, 200.0f, 120.0f, 30.0f, 30.0f,
+   50.0f, 110.0f, 40.0f, 200.0f, 130.0f, 100.0f, 70.0f, 200.0f,
+   -20.0f, 70.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   60.0f, 110.0f, 50.0f, 200.0f, 220.0f, 190.0f, 70.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 110.0f, 50.0f, 200.0f,
+   0.0f, -100.0f, -70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 80.0f, -20.0f, 200.0f, -10.0f, -160.0f, -60.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 110.0f, 100.0f, 200.0f,
+   90.0f, -10.0f, 60.0f, 200.0f, 140.0f, 30.0f, 140.0f, 200.0f,
+   110.0f, 170.0f, 200.0f, 180.0f, 100.0f, 100.0f, 200.0f, 110.0f,
+   -40.0f, 110.0f, 200.0f, 120.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 150.0f, 200.0f, 150.0f, 130.0f, 130.0f, 200.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 120.0f, 120.0f, 200.0f, 120.0f,
+   -70.0f, -60.0f, 200.0f, 120.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 150.0f, 200.0f, 150.0f, -160.0f, -60.0f, 200.0f, -50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 120.0f, 120.0f, 200.0f, 120.0f,
+   0.0f, 100.0f, 200.0f, 100.0f, 30.0f, 30.0f, 200.0f, 30.0f,
+   -30.0f, 200.0f, 100.0f, -50.0f, -70.0f, 200.0f, 90.0f, -150.0f,
+   -170.0f, 200.0f, 0.0f, -130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   10.0f, 200.0f, 140.0f, -60.0f, 70.0f, 200.0f, 180.0f, -20.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 40.0f, 200.0f, 170.0f, -10.0f,
+   -160.0f, 200.0f, 0.0f, -60.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -90.0f, 200.0f, 80.0f, -60.0f, -160.0f, 200.0f, -70.0f, -410.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 40.0f, 200.0f, 170.0f, -30.0f,
+   30.0f, 200.0f, 90.0f, -240.0f, 50.0f, 200.0f, 120.0f, 10.0f,
+   200.0f, 70.0f, 10.0f, 150.0f, 200.0f, 0.0f, -190.0f, -20.0f,
+   200.0f, 20.0f, -90.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 50.0f, -70.0f, 0.0f, 200.0f, 30.0f, -30.0f, -10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 20.0f, -70.0f, 40.0f,
+   200.0f, 20.0f, -80.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 50.0f, -100.0f, 110.0f, 200.0f, -160.0f, -440.0f, -100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 170.0f, -70.0f, 20.0f,
+   200.0f, 0.0f, -300.0f, 60.0f, 200.0f, 10.0f, -100.0f, 60.0f,
+   150.0f, 120.0f, 10.0f, 200.0f, 120.0f, 90.0f, -10.0f, 200.0f,
+   -50.0f, -80.0f, -190.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 90.0f, -20.0f, 200.0f, 180.0f, 90.0f, 90.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 0.0f, -10.0f, 200.0f,
+   10.0f, -20.0f, -130.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 80.0f, -20.0f, 200.0f, -70.0f, -200.0f, -130.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 100.0f, 90.0f, 200.0f,
+   -30.0f, -160.0f, -90.0f, 200.0f, 150.0f, 20.0f, 90.0f, 200.0f,
+   120.0f, 180.0f, 200.0f, 190.0f, 100.0f, 100.0f, 200.0f, 100.0f,
+   -80.0f, 20.0f, 200.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 90.0f, 200.0f, 100.0f, 100.0f, 100.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 0.0f, 0.0f, 200.0f, 0.0f,
+   -10.0f, 90.0f, 200.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 150.0f, 200.0f, 150.0f, -190.0f, -90.0f, 200.0f, -90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 100.0f, 100.0f, 200.0f, 110.0f,
+   -150.0f, -50.0f, 200.0f, -50.0f, 20.0f, 20.0f, 200.0f, 30.0f,
+   -50.0f, 200.0f, 110.0f, -30.0f, -80.0f, 200.0f, 90.0f, -150.0f,
+   -260.0f, 200.0f, -90.0f, -150.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -80.0f, 200.0f, 80.0f, -160.0f, 20.0f, 200.0f, 150.0f, -50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, -80.0f, 200.0f, 50.0f, -150.0f,
+   -190.0f, 200.0f, -20.0f, -90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -90.0f, 200.0f, 80.0f, -60.0f, -190.0f, 200.0f, -100.0f, -450.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 30.0f, 200.0f, 150.0f, -50.0f,
+   -150.0f, 200.0f, -60.0f, -410.0f, 30.0f, 200.0f, 110.0f, -50.0f,
+   200.0f, 80.0f, -70.0f, 150.0f, 200.0f, 0.0f, -190.0f, 20.0f,
+   200.0f, -80.0f, -190.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 0.0f, -200.0f, 20.0f, 200.0f, 0.0f, -90.0f, 20.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, -100.0f, -190.0f, -70.0f,
+   200.0f, -10.0f, -130.0f, 90.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 50.0f, -100.0f, 110.0f, 200.0f, -190.0f, -490.0f, -90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 0.0f, -90.0f, 30.0f,
+   200.0f, -150.0f, -450.0f, -50.0f, 200.0f, -70.0f, -90.0f, -50.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 190.0f, 160.0f, 50.0f, 200.0f,
+   90.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 170.0f, 60.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   90.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 110.0f, 0.0f, 200.0f, 70.0f, -60.0f, 10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   170.0f, 40.0f, 110.0f, 200.0f, 200.0f, 70.0f, 150.0f, 200.0f,
+   190.0f, 250.0f, 200.0f, 250.0f, 160.0f, 160.0f, 200.0f, 170.0f,
+   60.0f, 160.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 170.0f, 200.0f, 180.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   60.0f, 160.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 180.0f, 200.0f, 180.0f, -50.0f, 50.0f, 200.0f, 50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   40.0f, 140.0f, 200.0f, 150.0f, 80.0f, 80.0f, 200.0f, 80.0f,
+   10.0f, 200.0f, 180.0f, 40.0f, -10.0f, 200.0f, 150.0f, -90.0f,
+   -110.0f, 200.0f, 50.0f, -10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   0.0f, 200.0f, 160.0f, -80.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   -110.0f, 200.0f, 50.0f, -10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -60.0f, 200.0f, 110.0f, -30.0f, -50.0f, 200.0f, 40.0f, -310.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   50.0f, 200.0f, 130.0f, -210.0f, 80.0f, 200.0f, 170.0f, 10.0f,
+   200.0f, 150.0f, 0.0f, 210.0f, 200.0f, 60.0f, -130.0f, 90.0f,
+   200.0f, 70.0f, -50.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 70.0f, -120.0f, 100.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 70.0f, -50.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 80.0f, -70.0f, 140.0f, 200.0f, -50.0f, -350.0f, 50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 50.0f, -250.0f, 150.0f, 200.0f, -20.0f, -30.0f, 0.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 170.0f, 140.0f, 30.0f, 200.0f,
+   110.0f, 80.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 270.0f, 180.0f, 170.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 180.0f, 170.0f, 200.0f,
+   110.0f, 80.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 120.0f, 10.0f, 200.0f, 30.0f, -100.0f, -30.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   160.0f, 30.0f, 100.0f, 200.0f, 230.0f, 100.0f, 170.0f, 200.0f,
+   190.0f, 250.0f, 200.0f, 250.0f, 140.0f, 140.0f, 200.0f, 150.0f,
+   80.0f, 180.0f, 200.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 190.0f, 200.0f, 190.0f, 190.0f, 190.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 190.0f, 200.0f, 190.0f,
+   80.0f, 180.0f, 200.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 180.0f, 200.0f, 190.0f, -90.0f, 10.0f, 200.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   30.0f, 130.0f, 200.0f, 140.0f, 100.0f, 100.0f, 200.0f, 110.0f,
+   10.0f, 200.0f, 180.0f, 40.0f, -30.0f, 200.0f, 130.0f, -110.0f,
+   -90.0f, 200.0f, 70.0f, 10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   10.0f, 200.0f, 180.0f, -60.0f, 110.0f, 200.0f, 240.0f, 40.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 110.0f, 200.0f, 240.0f, 40.0f,
+   -90.0f, 200.0f, 70.0f, 10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -50.0f, 200.0f, 110.0f, -30.0f, -90.0f, 200.0f, 0.0f, -350.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   40.0f, 200.0f, 120.0f, -220.0f, 110.0f, 200.0f, 190.0f, 30.0f,
+   200.0f, 150.0f, 0.0f, 210.0f, 200.0f, 40.0f, -150.0f, 70.0f,
+   200.0f, 90.0f, -30.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 90.0f, -100.0f, 110.0f, 200.0f, 90.0f, 0.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 90.0f, 0.0f, 110.0f,
+   200.0f, 90.0f, -30.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 80.0f, -70.0f, 150.0f, 200.0f, -90.0f, -390.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 40.0f, -260.0f, 140.0f, 200.0f, 0.0f, -10.0f, 30.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 190.0f, 160.0f, 50.0f, 200.0f,
+   90.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 170.0f, 60.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   90.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 110.0f, 0.0f, 200.0f, 70.0f, -60.0f, 10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   170.0f, 40.0f, 110.0f, 200.0f, 200.0f, 70.0f, 150.0f, 200.0f,
+   190.0f, 250.0f, 200.0f, 250.0f, 160.0f, 160.0f, 200.0f, 170.0f,
+   60.0f, 160.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 170.0f, 200.0f, 180.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   60.0f, 160.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 180.0f, 200.0f, 180.0f, -50.0f, 50.0f, 200.0f, 50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   40.0f, 140.0f, 200.0f, 150.0f, 80.0f, 80.0f, 200.0f, 80.0f,
+   10.0f, 200.0f, 180.0f, 40.0f, -10.0f, 200.0f, 150.0f, -90.0f,
+   -110.0f, 200.0f, 50.0f, -10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   0.0f, 200.0f, 160.0f, -80.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   -110.0f, 200.0f, 50.0f, -10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -60.0f, 200.0f, 110.0f, -30.0f, -50.0f, 200.0f, 40.0f, -310.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   50.0f, 200.0f, 130.0f, -210.0f, 80.0f, 200.0f, 170.0f, 10.0f,
+   200.0f, 150.0f, 0.0f, 210.0f, 200.0f, 60.0f, -130.0f, 90.0f,
+   200.0f, 70.0f, -50.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 70.0f, -120.0f, 100.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 70.0f, -50.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 80.0f, -70.0f, 140.0f, 200.0f, -50.0f, -350.0f, 50.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 50.0f, -250.0f, 150.0f, 200.0f, -20.0f, -30.0f, 0.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 170.0f, 140.0f, 30.0f, 200.0f,
+   110.0f, 80.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 180.0f, 70.0f, 200.0f, 270.0f, 180.0f, 170.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 180.0f, 170.0f, 200.0f,
+   110.0f, 80.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 120.0f, 10.0f, 200.0f, 30.0f, -100.0f, -30.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 150.0f, 140.0f, 200.0f,
+   160.0f, 30.0f, 100.0f, 200.0f, 230.0f, 100.0f, 170.0f, 200.0f,
+   190.0f, 250.0f, 200.0f, 250.0f, 140.0f, 140.0f, 200.0f, 150.0f,
+   80.0f, 180.0f, 200.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 190.0f, 200.0f, 190.0f, 190.0f, 190.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 190.0f, 200.0f, 190.0f,
+   80.0f, 180.0f, 200.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   120.0f, 180.0f, 200.0f, 190.0f, -90.0f, 10.0f, 200.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   30.0f, 130.0f, 200.0f, 140.0f, 100.0f, 100.0f, 200.0f, 110.0f,
+   10.0f, 200.0f, 180.0f, 40.0f, -30.0f, 200.0f, 130.0f, -110.0f,
+   -90.0f, 200.0f, 70.0f, 10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   10.0f, 200.0f, 180.0f, -60.0f, 110.0f, 200.0f, 240.0f, 40.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 110.0f, 200.0f, 240.0f, 40.0f,
+   -90.0f, 200.0f, 70.0f, 10.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   -50.0f, 200.0f, 110.0f, -30.0f, -90.0f, 200.0f, 0.0f, -350.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 80.0f, 200.0f, 210.0f, 10.0f,
+   40.0f, 200.0f, 120.0f, -220.0f, 110.0f, 200.0f, 190.0f, 30.0f,
+   200.0f, 150.0f, 0.0f, 210.0f, 200.0f, 40.0f, -150.0f, 70.0f,
+   200.0f, 90.0f, -30.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 90.0f, -100.0f, 110.0f, 200.0f, 90.0f, 0.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 90.0f, 0.0f, 110.0f,
+   200.0f, 90.0f, -30.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 80.0f, -70.0f, 150.0f, 200.0f, -90.0f, -390.0f, 10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -30.0f, 80.0f,
+   200.0f, 40.0f, -260.0f, 140.0f, 200.0f, 0.0f, -10.0f, 30.0f,
+   200.0f, 190.0f, 80.0f, 200.0f, 190.0f, 180.0f, 70.0f, 200.0f,
+   100.0f, 90.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 220.0f, 110.0f, 200.0f, 280.0f, 210.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 190.0f, 180.0f, 200.0f,
+   100.0f, 90.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 160.0f, 50.0f, 200.0f, 30.0f, -80.0f, -10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 190.0f, 180.0f, 200.0f,
+   180.0f, 70.0f, 140.0f, 200.0f, 220.0f, 100.0f, 180.0f, 200.0f,
+   180.0f, 230.0f, 200.0f, 230.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   80.0f, 170.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 200.0f, 210.0f, 200.0f, 190.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 180.0f, 200.0f, 180.0f,
+   80.0f, 170.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 210.0f, 200.0f, 210.0f, -90.0f, 0.0f, 200.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 180.0f, 200.0f, 180.0f,
+   60.0f, 150.0f, 200.0f, 150.0f, 90.0f, 90.0f, 200.0f, 90.0f,
+   80.0f, 200.0f, 130.0f, 160.0f, 70.0f, 200.0f, 120.0f, 50.0f,
+   -20.0f, 200.0f, 30.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 170.0f, 90.0f, 200.0f, 200.0f, 210.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 160.0f,
+   -20.0f, 200.0f, 30.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   50.0f, 200.0f, 110.0f, 130.0f, -10.0f, 200.0f, -40.0f, -210.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 160.0f,
+   140.0f, 200.0f, 110.0f, -60.0f, 180.0f, 200.0f, 150.0f, 160.0f,
+   200.0f, 230.0f, 60.0f, 190.0f, 200.0f, 160.0f, -50.0f, 80.0f,
+   200.0f, 170.0f, 40.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 0.0f, 130.0f, 200.0f, 190.0f, 80.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 70.0f, 100.0f,
+   200.0f, 170.0f, 40.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 40.0f, 170.0f, 200.0f, 0.0f, -310.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 70.0f, 100.0f,
+   200.0f, 150.0f, -160.0f, 160.0f, 200.0f, 90.0f, 60.0f, 10.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 190.0f, 170.0f, 60.0f, 200.0f,
+   10.0f, 0.0f, -110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 170.0f, 60.0f, 200.0f, 250.0f, 170.0f, 160.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 70.0f, 70.0f, 200.0f,
+   70.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 160.0f, 50.0f, 200.0f, 0.0f, -120.0f, -50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 180.0f, 170.0f, 200.0f,
+   40.0f, -80.0f, -10.0f, 200.0f, 210.0f, 100.0f, 170.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   -10.0f, 80.0f, 200.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 150.0f, 200.0f, 150.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 60.0f, 60.0f, 200.0f, 60.0f,
+   50.0f, 140.0f, 200.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 210.0f, 200.0f, 210.0f, -130.0f, -30.0f, 200.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   -90.0f, 10.0f, 200.0f, 10.0f, 90.0f, 80.0f, 200.0f, 80.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 60.0f, 200.0f, 120.0f, 40.0f,
+   -110.0f, 200.0f, -60.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   60.0f, 200.0f, 110.0f, 40.0f, 160.0f, 200.0f, 180.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 70.0f, 200.0f, 80.0f, 50.0f,
+   -50.0f, 200.0f, 0.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   50.0f, 200.0f, 110.0f, 130.0f, -50.0f, 200.0f, -70.0f, -250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 180.0f, 150.0f,
+   -10.0f, 200.0f, -30.0f, -210.0f, 170.0f, 200.0f, 140.0f, 150.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 160.0f, -50.0f, 80.0f,
+   200.0f, 80.0f, -50.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 150.0f, -60.0f, 70.0f, 200.0f, 160.0f, 50.0f, 80.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -50.0f, -20.0f,
+   200.0f, 140.0f, 10.0f, 150.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 40.0f, 170.0f, 200.0f, -30.0f, -350.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 50.0f, 80.0f,
+   200.0f, 10.0f, -310.0f, 10.0f, 200.0f, 80.0f, 50.0f, 0.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 250.0f, 240.0f, 130.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 250.0f, 140.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 190.0f, 80.0f, 200.0f, 130.0f, 20.0f, 90.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   230.0f, 120.0f, 190.0f, 200.0f, 270.0f, 150.0f, 220.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 230.0f, 200.0f, 230.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 240.0f, 200.0f, 240.0f, 10.0f, 100.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   110.0f, 200.0f, 200.0f, 200.0f, 140.0f, 140.0f, 200.0f, 140.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 130.0f, 200.0f, 180.0f, 110.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 200.0f, 190.0f, 120.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 140.0f, 160.0f, 90.0f, 200.0f, 70.0f, -110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   190.0f, 200.0f, 160.0f, -10.0f, 220.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 220.0f, 10.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 230.0f, 20.0f, 150.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 100.0f, -210.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, -110.0f, 200.0f, 200.0f, 140.0f, 110.0f, 60.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 230.0f, 220.0f, 110.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 100.0f, -20.0f, 50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   220.0f, 110.0f, 180.0f, 200.0f, 290.0f, 180.0f, 250.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 210.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   250.0f, 250.0f, 200.0f, 250.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, -30.0f, 70.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   100.0f, 190.0f, 200.0f, 190.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 110.0f, 200.0f, 160.0f, 90.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 200.0f, 210.0f, 130.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 50.0f, 200.0f, 30.0f, -150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   180.0f, 200.0f, 150.0f, -20.0f, 250.0f, 200.0f, 220.0f, 230.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 200.0f, -10.0f, 120.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 250.0f, 30.0f, 170.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 70.0f, -250.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 190.0f, -120.0f, 190.0f, 200.0f, 160.0f, 130.0f, 80.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 250.0f, 240.0f, 130.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 250.0f, 140.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 190.0f, 80.0f, 200.0f, 130.0f, 20.0f, 90.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   230.0f, 120.0f, 190.0f, 200.0f, 270.0f, 150.0f, 220.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 230.0f, 200.0f, 230.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 240.0f, 200.0f, 240.0f, 10.0f, 100.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   110.0f, 200.0f, 200.0f, 200.0f, 140.0f, 140.0f, 200.0f, 140.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 130.0f, 200.0f, 180.0f, 110.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 200.0f, 190.0f, 120.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 140.0f, 160.0f, 90.0f, 200.0f, 70.0f, -110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   190.0f, 200.0f, 160.0f, -10.0f, 220.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 220.0f, 10.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 230.0f, 20.0f, 150.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 100.0f, -210.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, -110.0f, 200.0f, 200.0f, 140.0f, 110.0f, 60.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 230.0f, 220.0f, 110.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 100.0f, -20.0f, 50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   220.0f, 110.0f, 180.0f, 200.0f, 290.0f, 180.0f, 250.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 210.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   250.0f, 250.0f, 200.0f, 250.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, -30.0f, 70.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   100.0f, 190.0f, 200.0f, 190.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 110.0f, 200.0f, 160.0f, 90.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 200.0f, 210.0f, 130.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 50.0f, 200.0f, 30.0f, -150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   180.0f, 200.0f, 150.0f, -20.0f, 250.0f, 200.0f, 220.0f, 230.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 200.0f, -10.0f, 120.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 250.0f, 30.0f, 170.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 70.0f, -250.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 190.0f, -120.0f, 190.0f, 200.0f, 160.0f, 130.0f, 80.0f,
+   200.0f, 200.0f, 100.0f, 200.0f, 190.0f, 190.0f, 90.0f, 200.0f,
+   100.0f, 100.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 240.0f, 130.0f, 200.0f, 280.0f, 220.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 210.0f, 200.0f, 200.0f,
+   100.0f, 100.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 70.0f, 200.0f, 30.0f, -70.0f, 10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 210.0f, 200.0f, 200.0f,
+   180.0f, 80.0f, 160.0f, 200.0f, 220.0f, 120.0f, 190.0f, 200.0f,
+   160.0f, 260.0f, 200.0f, 230.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   60.0f, 200.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 210.0f, 180.0f, 220.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 210.0f, 200.0f, 180.0f,
+   60.0f, 200.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 240.0f, 200.0f, 210.0f, -110.0f, 30.0f, 200.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 210.0f, 200.0f, 180.0f,
+   40.0f, 180.0f, 200.0f, 150.0f, 70.0f, 120.0f, 200.0f, 90.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 90.0f, 200.0f, 130.0f, 40.0f,
+   0.0f, 200.0f, 40.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 200.0f, 170.0f, 80.0f, 220.0f, 200.0f, 220.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 150.0f,
+   0.0f, 200.0f, 40.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   70.0f, 200.0f, 110.0f, 120.0f, 10.0f, 200.0f, -30.0f, -220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 150.0f,
+   160.0f, 200.0f, 120.0f, -70.0f, 190.0f, 200.0f, 150.0f, 150.0f,
+   200.0f, 260.0f, 20.0f, 220.0f, 200.0f, 190.0f, -90.0f, 110.0f,
+   200.0f, 200.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, -40.0f, 150.0f, 200.0f, 220.0f, 40.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 0.0f, 190.0f, 200.0f, 30.0f, -350.0f, 30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 180.0f, -200.0f, 180.0f, 200.0f, 120.0f, 20.0f, 30.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 190.0f, 190.0f, 80.0f, 200.0f,
+   10.0f, 10.0f, -90.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 80.0f, 200.0f, 250.0f, 190.0f, 180.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 90.0f, 90.0f, 200.0f,
+   70.0f, 70.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 70.0f, 200.0f, 0.0f, -100.0f, -30.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 190.0f, 190.0f, 200.0f,
+   40.0f, -60.0f, 10.0f, 200.0f, 210.0f, 110.0f, 190.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, 140.0f, 190.0f, 200.0f, 160.0f,
+   -30.0f, 110.0f, 200.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 180.0f, 200.0f, 150.0f, 140.0f, 190.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 40.0f, 90.0f, 200.0f, 60.0f,
+   30.0f, 170.0f, 200.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 240.0f, 200.0f, 210.0f, -150.0f, 0.0f, 200.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   -110.0f, 40.0f, 200.0f, 10.0f, 70.0f, 110.0f, 200.0f, 80.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 80.0f, 200.0f, 120.0f, 30.0f,
+   -90.0f, 200.0f, -50.0f, 40.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 120.0f, 30.0f, 180.0f, 200.0f, 180.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 90.0f, 200.0f, 80.0f, 40.0f,
+   -30.0f, 200.0f, 10.0f, 100.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   70.0f, 200.0f, 110.0f, 120.0f, -30.0f, 200.0f, -70.0f, -260.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 200.0f, 190.0f, 140.0f,
+   10.0f, 200.0f, -30.0f, -220.0f, 190.0f, 200.0f, 150.0f, 140.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 190.0f, -90.0f, 100.0f,
+   200.0f, 110.0f, -90.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 180.0f, -100.0f, 100.0f, 200.0f, 190.0f, 10.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 90.0f, -90.0f, 0.0f,
+   200.0f, 170.0f, -30.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 0.0f, 190.0f, 200.0f, 0.0f, -390.0f, -10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 10.0f, 110.0f,
+   200.0f, 40.0f, -350.0f, 30.0f, 200.0f, 110.0f, 10.0f, 30.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 250.0f, 250.0f, 150.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 260.0f, 160.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 100.0f, 200.0f, 130.0f, 30.0f, 110.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   230.0f, 130.0f, 210.0f, 200.0f, 270.0f, 170.0f, 240.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 210.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   220.0f, 260.0f, 200.0f, 230.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 270.0f, 200.0f, 240.0f, -10.0f, 130.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   90.0f, 230.0f, 200.0f, 200.0f, 120.0f, 170.0f, 200.0f, 140.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 150.0f, 200.0f, 190.0f, 100.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 200.0f, 200.0f, 110.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 110.0f, 200.0f, 70.0f, -120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   210.0f, 200.0f, 170.0f, -20.0f, 240.0f, 200.0f, 200.0f, 190.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 250.0f, -30.0f, 170.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 260.0f, -20.0f, 180.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 130.0f, -250.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 230.0f, -150.0f, 230.0f, 200.0f, 170.0f, 70.0f, 80.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 230.0f, 230.0f, 130.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 100.0f, 0.0f, 70.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   220.0f, 120.0f, 200.0f, 200.0f, 290.0f, 190.0f, 270.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 190.0f, 230.0f, 200.0f, 200.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   230.0f, 280.0f, 200.0f, 250.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, -50.0f, 100.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   80.0f, 220.0f, 200.0f, 190.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 130.0f, 200.0f, 170.0f, 80.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 200.0f, 210.0f, 120.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 70.0f, 200.0f, 30.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 160.0f, -30.0f, 270.0f, 200.0f, 230.0f, 220.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 230.0f, -50.0f, 150.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 280.0f, 0.0f, 190.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 100.0f, -290.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 220.0f, -160.0f, 220.0f, 200.0f, 190.0f, 90.0f, 110.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 250.0f, 250.0f, 150.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 260.0f, 160.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 100.0f, 200.0f, 130.0f, 30.0f, 110.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   230.0f, 130.0f, 210.0f, 200.0f, 270.0f, 170.0f, 240.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 210.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   220.0f, 260.0f, 200.0f, 230.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 270.0f, 200.0f, 240.0f, -10.0f, 130.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   90.0f, 230.0f, 200.0f, 200.0f, 120.0f, 170.0f, 200.0f, 140.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 150.0f, 200.0f, 190.0f, 100.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 200.0f, 200.0f, 110.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 110.0f, 200.0f, 70.0f, -120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   210.0f, 200.0f, 170.0f, -20.0f, 240.0f, 200.0f, 200.0f, 190.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 250.0f, -30.0f, 170.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 260.0f, -20.0f, 180.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 130.0f, -250.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 230.0f, -150.0f, 230.0f, 200.0f, 170.0f, 70.0f, 80.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 230.0f, 230.0f, 130.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 100.0f, 0.0f, 70.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   220.0f, 120.0f, 200.0f, 200.0f, 290.0f, 190.0f, 270.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 190.0f, 230.0f, 200.0f, 200.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   230.0f, 280.0f, 200.0f, 250.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, -50.0f, 100.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   80.0f, 220.0f, 200.0f, 190.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 130.0f, 200.0f, 170.0f, 80.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 200.0f, 210.0f, 120.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 70.0f, 200.0f, 30.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 160.0f, -30.0f, 270.0f, 200.0f, 230.0f, 220.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 230.0f, -50.0f, 150.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 280.0f, 0.0f, 190.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 100.0f, -290.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 220.0f, -160.0f, 220.0f, 200.0f, 190.0f, 90.0f, 110.0f,
+   200.0f, 190.0f, 80.0f, 200.0f, 190.0f, 180.0f, 70.0f, 200.0f,
+   100.0f, 90.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 220.0f, 110.0f, 200.0f, 280.0f, 210.0f, 200.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 190.0f, 180.0f, 200.0f,
+   100.0f, 90.0f, -20.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 160.0f, 50.0f, 200.0f, 30.0f, -80.0f, -10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 190.0f, 180.0f, 200.0f,
+   180.0f, 70.0f, 140.0f, 200.0f, 220.0f, 100.0f, 180.0f, 200.0f,
+   180.0f, 230.0f, 200.0f, 230.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   80.0f, 170.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 200.0f, 210.0f, 200.0f, 190.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 180.0f, 200.0f, 180.0f,
+   80.0f, 170.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 210.0f, 200.0f, 210.0f, -90.0f, 0.0f, 200.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 180.0f, 200.0f, 180.0f,
+   60.0f, 150.0f, 200.0f, 150.0f, 90.0f, 90.0f, 200.0f, 90.0f,
+   80.0f, 200.0f, 130.0f, 160.0f, 70.0f, 200.0f, 120.0f, 50.0f,
+   -20.0f, 200.0f, 30.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 170.0f, 90.0f, 200.0f, 200.0f, 210.0f, 180.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 160.0f,
+   -20.0f, 200.0f, 30.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   50.0f, 200.0f, 110.0f, 130.0f, -10.0f, 200.0f, -40.0f, -210.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 200.0f, 200.0f, 160.0f,
+   140.0f, 200.0f, 110.0f, -60.0f, 180.0f, 200.0f, 150.0f, 160.0f,
+   200.0f, 230.0f, 60.0f, 190.0f, 200.0f, 160.0f, -50.0f, 80.0f,
+   200.0f, 170.0f, 40.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 0.0f, 130.0f, 200.0f, 190.0f, 80.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 70.0f, 100.0f,
+   200.0f, 170.0f, 40.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 40.0f, 170.0f, 200.0f, 0.0f, -310.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 180.0f, 70.0f, 100.0f,
+   200.0f, 150.0f, -160.0f, 160.0f, 200.0f, 90.0f, 60.0f, 10.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 190.0f, 170.0f, 60.0f, 200.0f,
+   10.0f, 0.0f, -110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 170.0f, 60.0f, 200.0f, 250.0f, 170.0f, 160.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 70.0f, 70.0f, 200.0f,
+   70.0f, 60.0f, -50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 160.0f, 50.0f, 200.0f, 0.0f, -120.0f, -50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 180.0f, 170.0f, 200.0f,
+   40.0f, -80.0f, -10.0f, 200.0f, 210.0f, 100.0f, 170.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   -10.0f, 80.0f, 200.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 150.0f, 200.0f, 150.0f, 160.0f, 160.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 60.0f, 60.0f, 200.0f, 60.0f,
+   50.0f, 140.0f, 200.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 210.0f, 200.0f, 210.0f, -130.0f, -30.0f, 200.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   -90.0f, 10.0f, 200.0f, 10.0f, 90.0f, 80.0f, 200.0f, 80.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 60.0f, 200.0f, 120.0f, 40.0f,
+   -110.0f, 200.0f, -60.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   60.0f, 200.0f, 110.0f, 40.0f, 160.0f, 200.0f, 180.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 70.0f, 200.0f, 80.0f, 50.0f,
+   -50.0f, 200.0f, 0.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   50.0f, 200.0f, 110.0f, 130.0f, -50.0f, 200.0f, -70.0f, -250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 170.0f, 200.0f, 180.0f, 150.0f,
+   -10.0f, 200.0f, -30.0f, -210.0f, 170.0f, 200.0f, 140.0f, 150.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 160.0f, -50.0f, 80.0f,
+   200.0f, 80.0f, -50.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 150.0f, -60.0f, 70.0f, 200.0f, 160.0f, 50.0f, 80.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 60.0f, -50.0f, -20.0f,
+   200.0f, 140.0f, 10.0f, 150.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 210.0f, 40.0f, 170.0f, 200.0f, -30.0f, -350.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 50.0f, 80.0f,
+   200.0f, 10.0f, -310.0f, 10.0f, 200.0f, 80.0f, 50.0f, 0.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 250.0f, 240.0f, 130.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 250.0f, 140.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 190.0f, 80.0f, 200.0f, 130.0f, 20.0f, 90.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   230.0f, 120.0f, 190.0f, 200.0f, 270.0f, 150.0f, 220.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 230.0f, 200.0f, 230.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 240.0f, 200.0f, 240.0f, 10.0f, 100.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   110.0f, 200.0f, 200.0f, 200.0f, 140.0f, 140.0f, 200.0f, 140.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 130.0f, 200.0f, 180.0f, 110.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 200.0f, 190.0f, 120.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 140.0f, 160.0f, 90.0f, 200.0f, 70.0f, -110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   190.0f, 200.0f, 160.0f, -10.0f, 220.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 220.0f, 10.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 230.0f, 20.0f, 150.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 100.0f, -210.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, -110.0f, 200.0f, 200.0f, 140.0f, 110.0f, 60.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 230.0f, 220.0f, 110.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 100.0f, -20.0f, 50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   220.0f, 110.0f, 180.0f, 200.0f, 290.0f, 180.0f, 250.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 210.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   250.0f, 250.0f, 200.0f, 250.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, -30.0f, 70.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   100.0f, 190.0f, 200.0f, 190.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 110.0f, 200.0f, 160.0f, 90.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 200.0f, 210.0f, 130.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 50.0f, 200.0f, 30.0f, -150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   180.0f, 200.0f, 150.0f, -20.0f, 250.0f, 200.0f, 220.0f, 230.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 200.0f, -10.0f, 120.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 250.0f, 30.0f, 170.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 70.0f, -250.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 190.0f, -120.0f, 190.0f, 200.0f, 160.0f, 130.0f, 80.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 250.0f, 240.0f, 130.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 250.0f, 140.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   150.0f, 140.0f, 30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 190.0f, 80.0f, 200.0f, 130.0f, 20.0f, 90.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   230.0f, 120.0f, 190.0f, 200.0f, 270.0f, 150.0f, 220.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 230.0f, 200.0f, 230.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   130.0f, 220.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 240.0f, 200.0f, 240.0f, 10.0f, 100.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   110.0f, 200.0f, 200.0f, 200.0f, 140.0f, 140.0f, 200.0f, 140.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 130.0f, 200.0f, 180.0f, 110.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 200.0f, 190.0f, 120.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   30.0f, 200.0f, 80.0f, 190.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 140.0f, 160.0f, 90.0f, 200.0f, 70.0f, -110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   190.0f, 200.0f, 160.0f, -10.0f, 220.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 220.0f, 10.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 230.0f, 20.0f, 150.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 220.0f, 90.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 100.0f, -210.0f, 110.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 200.0f, -110.0f, 200.0f, 200.0f, 140.0f, 110.0f, 60.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 230.0f, 220.0f, 110.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 260.0f, 150.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 260.0f, 250.0f, 200.0f,
+   170.0f, 160.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 200.0f, 90.0f, 200.0f, 100.0f, -20.0f, 50.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 230.0f, 220.0f, 200.0f,
+   220.0f, 110.0f, 180.0f, 200.0f, 290.0f, 180.0f, 250.0f, 200.0f,
+   250.0f, 310.0f, 200.0f, 310.0f, 210.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   250.0f, 250.0f, 200.0f, 250.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 250.0f, 200.0f, 250.0f,
+   150.0f, 240.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 240.0f, -30.0f, 70.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 220.0f, 200.0f, 220.0f,
+   100.0f, 190.0f, 200.0f, 190.0f, 170.0f, 160.0f, 200.0f, 160.0f,
+   150.0f, 200.0f, 210.0f, 230.0f, 110.0f, 200.0f, 160.0f, 90.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   150.0f, 200.0f, 210.0f, 130.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 270.0f, 230.0f,
+   50.0f, 200.0f, 100.0f, 210.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   90.0f, 200.0f, 140.0f, 170.0f, 50.0f, 200.0f, 30.0f, -150.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 200.0f, 240.0f, 200.0f,
+   180.0f, 200.0f, 150.0f, -20.0f, 250.0f, 200.0f, 220.0f, 230.0f,
+   200.0f, 310.0f, 130.0f, 270.0f, 200.0f, 200.0f, -10.0f, 120.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 250.0f, 30.0f, 170.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 130.0f, 170.0f,
+   200.0f, 240.0f, 110.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 70.0f, 200.0f, 200.0f, 70.0f, -250.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 220.0f, 100.0f, 140.0f,
+   200.0f, 190.0f, -120.0f, 190.0f, 200.0f, 160.0f, 130.0f, 80.0f,
+   200.0f, 200.0f, 100.0f, 200.0f, 190.0f, 190.0f, 90.0f, 200.0f,
+   100.0f, 100.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   240.0f, 240.0f, 130.0f, 200.0f, 280.0f, 220.0f, 220.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 210.0f, 200.0f, 200.0f,
+   100.0f, 100.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 70.0f, 200.0f, 30.0f, -70.0f, 10.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 210.0f, 200.0f, 200.0f,
+   180.0f, 80.0f, 160.0f, 200.0f, 220.0f, 120.0f, 190.0f, 200.0f,
+   160.0f, 260.0f, 200.0f, 230.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   60.0f, 200.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   190.0f, 240.0f, 200.0f, 210.0f, 180.0f, 220.0f, 200.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 210.0f, 200.0f, 180.0f,
+   60.0f, 200.0f, 200.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 240.0f, 200.0f, 210.0f, -110.0f, 30.0f, 200.0f, 0.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 160.0f, 210.0f, 200.0f, 180.0f,
+   40.0f, 180.0f, 200.0f, 150.0f, 70.0f, 120.0f, 200.0f, 90.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 90.0f, 200.0f, 130.0f, 40.0f,
+   0.0f, 200.0f, 40.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 200.0f, 170.0f, 80.0f, 220.0f, 200.0f, 220.0f, 170.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 150.0f,
+   0.0f, 200.0f, 40.0f, 130.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   70.0f, 200.0f, 110.0f, 120.0f, 10.0f, 200.0f, -30.0f, -220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 150.0f,
+   160.0f, 200.0f, 120.0f, -70.0f, 190.0f, 200.0f, 150.0f, 150.0f,
+   200.0f, 260.0f, 20.0f, 220.0f, 200.0f, 190.0f, -90.0f, 110.0f,
+   200.0f, 200.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, -40.0f, 150.0f, 200.0f, 220.0f, 40.0f, 140.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 200.0f, 0.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 0.0f, 190.0f, 200.0f, 30.0f, -350.0f, 30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 210.0f, 30.0f, 120.0f,
+   200.0f, 180.0f, -200.0f, 180.0f, 200.0f, 120.0f, 20.0f, 30.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 190.0f, 190.0f, 80.0f, 200.0f,
+   10.0f, 10.0f, -90.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 80.0f, 200.0f, 250.0f, 190.0f, 180.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 90.0f, 90.0f, 200.0f,
+   70.0f, 70.0f, -30.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   180.0f, 180.0f, 70.0f, 200.0f, 0.0f, -100.0f, -30.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 190.0f, 190.0f, 200.0f,
+   40.0f, -60.0f, 10.0f, 200.0f, 210.0f, 110.0f, 190.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, 140.0f, 190.0f, 200.0f, 160.0f,
+   -30.0f, 110.0f, 200.0f, 80.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   140.0f, 180.0f, 200.0f, 150.0f, 140.0f, 190.0f, 200.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 40.0f, 90.0f, 200.0f, 60.0f,
+   30.0f, 170.0f, 200.0f, 140.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   130.0f, 240.0f, 200.0f, 210.0f, -150.0f, 0.0f, 200.0f, -30.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   -110.0f, 40.0f, 200.0f, 10.0f, 70.0f, 110.0f, 200.0f, 80.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 80.0f, 200.0f, 120.0f, 30.0f,
+   -90.0f, 200.0f, -50.0f, 40.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   80.0f, 200.0f, 120.0f, 30.0f, 180.0f, 200.0f, 180.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 90.0f, 200.0f, 80.0f, 40.0f,
+   -30.0f, 200.0f, 10.0f, 100.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   70.0f, 200.0f, 110.0f, 120.0f, -30.0f, 200.0f, -70.0f, -260.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 200.0f, 190.0f, 140.0f,
+   10.0f, 200.0f, -30.0f, -220.0f, 190.0f, 200.0f, 150.0f, 140.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 190.0f, -90.0f, 100.0f,
+   200.0f, 110.0f, -90.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 180.0f, -100.0f, 100.0f, 200.0f, 190.0f, 10.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 90.0f, -90.0f, 0.0f,
+   200.0f, 170.0f, -30.0f, 170.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 240.0f, 0.0f, 190.0f, 200.0f, 0.0f, -390.0f, -10.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 190.0f, 10.0f, 110.0f,
+   200.0f, 40.0f, -350.0f, 30.0f, 200.0f, 110.0f, 10.0f, 30.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 250.0f, 250.0f, 150.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 260.0f, 160.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 100.0f, 200.0f, 130.0f, 30.0f, 110.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   230.0f, 130.0f, 210.0f, 200.0f, 270.0f, 170.0f, 240.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 210.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   220.0f, 260.0f, 200.0f, 230.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 270.0f, 200.0f, 240.0f, -10.0f, 130.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   90.0f, 230.0f, 200.0f, 200.0f, 120.0f, 170.0f, 200.0f, 140.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 150.0f, 200.0f, 190.0f, 100.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 200.0f, 200.0f, 110.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 110.0f, 200.0f, 70.0f, -120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   210.0f, 200.0f, 170.0f, -20.0f, 240.0f, 200.0f, 200.0f, 190.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 250.0f, -30.0f, 170.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 260.0f, -20.0f, 180.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 130.0f, -250.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 230.0f, -150.0f, 230.0f, 200.0f, 170.0f, 70.0f, 80.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 230.0f, 230.0f, 130.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 100.0f, 0.0f, 70.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   220.0f, 120.0f, 200.0f, 200.0f, 290.0f, 190.0f, 270.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 190.0f, 230.0f, 200.0f, 200.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   230.0f, 280.0f, 200.0f, 250.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, -50.0f, 100.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   80.0f, 220.0f, 200.0f, 190.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 130.0f, 200.0f, 170.0f, 80.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 200.0f, 210.0f, 120.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 70.0f, 200.0f, 30.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 160.0f, -30.0f, 270.0f, 200.0f, 230.0f, 220.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 230.0f, -50.0f, 150.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 280.0f, 0.0f, 190.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 100.0f, -290.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 220.0f, -160.0f, 220.0f, 200.0f, 190.0f, 90.0f, 110.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 250.0f, 250.0f, 150.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   260.0f, 260.0f, 160.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   150.0f, 150.0f, 50.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 100.0f, 200.0f, 130.0f, 30.0f, 110.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   230.0f, 130.0f, 210.0f, 200.0f, 270.0f, 170.0f, 240.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 210.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   220.0f, 260.0f, 200.0f, 230.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   110.0f, 250.0f, 200.0f, 220.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 270.0f, 200.0f, 240.0f, -10.0f, 130.0f, 200.0f, 100.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   90.0f, 230.0f, 200.0f, 200.0f, 120.0f, 170.0f, 200.0f, 140.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 150.0f, 200.0f, 190.0f, 100.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   160.0f, 200.0f, 200.0f, 110.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   50.0f, 200.0f, 90.0f, 180.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   100.0f, 200.0f, 140.0f, 150.0f, 110.0f, 200.0f, 70.0f, -120.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   210.0f, 200.0f, 170.0f, -20.0f, 240.0f, 200.0f, 200.0f, 190.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 250.0f, -30.0f, 170.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 260.0f, -20.0f, 180.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 250.0f, 50.0f, 250.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 220.0f, 200.0f, 130.0f, -250.0f, 130.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 230.0f, -150.0f, 230.0f, 200.0f, 170.0f, 70.0f, 80.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 230.0f, 230.0f, 130.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   280.0f, 280.0f, 170.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 340.0f, 280.0f, 270.0f, 200.0f,
+   170.0f, 170.0f, 70.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   210.0f, 210.0f, 110.0f, 200.0f, 100.0f, 0.0f, 70.0f, 200.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 310.0f, 250.0f, 240.0f, 200.0f,
+   220.0f, 120.0f, 200.0f, 200.0f, 290.0f, 190.0f, 270.0f, 200.0f,
+   230.0f, 340.0f, 200.0f, 310.0f, 190.0f, 230.0f, 200.0f, 200.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   230.0f, 280.0f, 200.0f, 250.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 230.0f, 280.0f, 200.0f, 250.0f,
+   130.0f, 270.0f, 200.0f, 240.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 270.0f, 200.0f, 240.0f, -50.0f, 100.0f, 200.0f, 70.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 200.0f, 220.0f,
+   80.0f, 220.0f, 200.0f, 190.0f, 150.0f, 190.0f, 200.0f, 160.0f,
+   170.0f, 200.0f, 210.0f, 220.0f, 130.0f, 200.0f, 170.0f, 80.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   170.0f, 200.0f, 210.0f, 120.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 270.0f, 200.0f, 270.0f, 220.0f,
+   70.0f, 200.0f, 110.0f, 200.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   110.0f, 200.0f, 150.0f, 160.0f, 70.0f, 200.0f, 30.0f, -160.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 240.0f, 200.0f, 240.0f, 190.0f,
+   200.0f, 200.0f, 160.0f, -30.0f, 270.0f, 200.0f, 230.0f, 220.0f,
+   200.0f, 340.0f, 100.0f, 290.0f, 200.0f, 230.0f, -50.0f, 150.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 280.0f, 0.0f, 190.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 280.0f, 100.0f, 190.0f,
+   200.0f, 270.0f, 70.0f, 270.0f, 200.0f, 200.0f, 200.0f, 200.0f,
+   200.0f, 270.0f, 30.0f, 230.0f, 200.0f, 100.0f, -290.0f, 90.0f,
+   200.0f, 200.0f, 200.0f, 200.0f, 200.0f, 250.0f, 70.0f, 160.0f,
+   200.0f, 220.0f, -160.0f, 220.0f, 200.0f, 190.0f, 90.0f, 110.0f,
+};
+
+/* mismatch_interior */
+static const float nn_default_17[96] = {
+   0.0f, 0.0f, -110.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -110.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -70.0f,
+   0.0f, 0.0f, -110.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -110.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -70.0f,
+   70.0f, 70.0f, -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f,
+   -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 0.0f,
+   70.0f, 70.0f, -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f,
+   -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 0.0f,
+   70.0f, 70.0f, -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f,
+   -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 0.0f,
+   70.0f, 70.0f, -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f,
+   -40.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 70.0f, 0.0f,
+};
+
+static const void* const nn_default_tables[] = {
+   nn_default_00, nn_default_01, nn_default_02, nn_default_03,
+   nn_default_04, nn_default_05, nn_default_06, nn_default_07,
+   nn_default_08, nn_default_09, nn_default_10, nn_default_11,
+   nn_default_12, nn_default_13, nn_default_14, nn_default_15,
+   nn_default_16, nn_default_17,
+};
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Stefan Bienert
+ *
+ * This file is part of CoRB.
+ *
+ * CoRB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CoRB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CoRB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ ****   Documentation header   ***
+ *
+ *  @file libcrbrna/nn_scores_gen.c
+ *
+ *  @brief Generator of the standard Nearest Neighbour tables
+ *
+ *  Module: nn_scores
+ *
+ *  Library: crbrna
+ *
+ *  Project: CoRB - Collection of RNAanalysis Binaries
+ *
+ *  @author Stefan Bienert
+ *
+ *  @date 2026-10-18
+ *
+ *
+ *  Revision History:
+ *         - 2026Oct18 bienert: created
+ *
+ */
+
+/* Build time helper: sets up the standard parameters from their traditional
+   notation in nn_scores.c (compiled with NN_SCORES_GEN) and writes them as
+   constant tables to stdout, which become nn_scores_default.h. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <libcrbbasic/crbbasic.h>
+#include "alphabet.h"
+#include "nn_scores.h"
+
+int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
+{
+   Alphabet* sigma;
+   NN_scores* scores = NULL;
+   int error = 0;
+
+   sigma = ALPHABET_NEW_PAIR ("ACGU", "acgu", 4);
+   if (sigma == NULL)
+   {
+      error = 1;
+   }
+
+   if (!error)
+   {
+      scores = NN_SCORES_NEW_INIT (0.0f, sigma);
+      if (scores == NULL)
+      {
+         error = 1;
+      }
+   }
+
+   if (!error)
+   {
+      error = nn_scores_fprintf_default (stdout, scores, sigma);
+   }
+
+   nn_scores_delete (scores);
+   alphabet_delete (sigma);
+
+   FREE_MEMORY_MANAGER;
+
+   if (error)
+   {
+      THROW_ERROR_MSG ("Could not write the standard tables");
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
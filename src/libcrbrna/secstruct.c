@@ -42,6 +42,7 @@
  *                              secondary structure element, makes it possible
  *                              to query the structural feature a certain
  *                              position in the sequence belong to.
+ *         - 2026Oct18 bienert: Added integer energy evaluation
  *
  */
 
@@ -2239,6 +2240,105 @@ secstruct_calculate_DG (const char* seq, const NN_scores* scores,
    return G;
 }
 
+/** @brief Calculate the free energy of a structure with integer tables.
+ *
+ * Integer counterpart of @c secstruct_calculate_DG(). All contributions are
+ * read from an integer scoring scheme, so the result is exact and does not
+ * depend on floating point arithmetic. The scheme has to be created for
+ * loops at least as long as the longest loop of the structure.\n
+ * Returns the free energy.
+ *
+ * @param[in] seq sequence.
+ * @param[in] scores integer scoring scheme.
+ * @param[in] this secondary structure.
+ */
+int
+secstruct_calculate_DG_int (const char* seq, const NN_int_scores* scores,
+                            const SecStruct* this)
+{
+   unsigned long k;
+   int G = 0;
+
+   assert (seq);
+   assert (scores);
+   assert (this);
+
+   /* external loop */
+   G += nn_int_scores_get_G_extloop_multiloop (seq,
+                                               this->ext_loop.unpaired,
+                                               this->ext_loop.nstems,
+                                               this->ext_loop.stems,
+                                               this->ext_loop.ndangle5,
+                                               this->ext_loop.dangle5,
+                                               this->ext_loop.ndangle3,
+                                               this->ext_loop.dangle3,
+                                               false,
+                                               scores);
+
+   /* stacking pairs */
+   for (k = 0; k < ARRAY_CURRENT (this->stack); k++)
+   {
+      G += nn_int_scores_get_G_stack (
+                                 seq[ARRAY_ACCESS (this->stack, k).i],
+                                 seq[ARRAY_ACCESS (this->stack, k).j],
+                                 seq[ARRAY_ACCESS (this->stack, k).j - 1],
+                                 seq[ARRAY_ACCESS (this->stack, k).i + 1],
+                                 scores);
+   }
+
+   /* bulge loops */
+   for (k = 0; k < ARRAY_CURRENT (this->bulge_loop); k++)
+   {
+      G += nn_int_scores_get_G_bulge_loop (
+                                     seq[ARRAY_ACCESS (this->bulge_loop, k).i1],
+                                     seq[ARRAY_ACCESS (this->bulge_loop, k).j1],
+                                     seq[ARRAY_ACCESS (this->bulge_loop, k).i2],
+                                     seq[ARRAY_ACCESS (this->bulge_loop, k).j2],
+                                     ARRAY_ACCESS (this->bulge_loop, k).size,
+                                           scores);
+   }
+
+   /* internal loops */
+   for (k = 0; k < ARRAY_CURRENT (this->internal_loop); k++)
+   {
+      G += nn_int_scores_get_G_internal_loop (seq,
+                                    ARRAY_ACCESS (this->internal_loop, k).size1,
+                                    ARRAY_ACCESS (this->internal_loop, k).size2,
+                                    ARRAY_ACCESS (this->internal_loop, k).i1,
+                                    ARRAY_ACCESS (this->internal_loop, k).j1,
+                                    ARRAY_ACCESS (this->internal_loop, k).i2,
+                                    ARRAY_ACCESS (this->internal_loop, k).j2,
+                                              scores);
+   }
+
+   /* hairpins */
+   for (k = 0; k < ARRAY_CURRENT (this->hairpin_loop); k++)
+   {
+      G += nn_int_scores_get_G_hairpin_loop (seq,
+                                         ARRAY_ACCESS (this->hairpin_loop, k).i,
+                                         ARRAY_ACCESS (this->hairpin_loop, k).j,
+                                      ARRAY_ACCESS (this->hairpin_loop, k).size,
+                                             scores);
+   }
+
+   /* multiloops */
+   for (k = 0; k < ARRAY_CURRENT (this->multi_loop); k++)
+   {
+      G += nn_int_scores_get_G_extloop_multiloop (seq,
+                                    ARRAY_ACCESS (this->multi_loop, k).unpaired,
+                                    ARRAY_ACCESS (this->multi_loop, k).nstems,
+                                    ARRAY_ACCESS (this->multi_loop, k).stems,
+                                    ARRAY_ACCESS (this->multi_loop, k).ndangle5,
+                                    ARRAY_ACCESS (this->multi_loop, k).dangle5,
+                                    ARRAY_ACCESS (this->multi_loop, k).ndangle3,
+                                    ARRAY_ACCESS (this->multi_loop, k).dangle3,
+                                                  true,
+                                                  scores);
+   }
+
+   return G;
+}
+
 
 /*********************************   Output   *********************************/
 
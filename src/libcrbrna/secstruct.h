@@ -304,6 +304,10 @@ secstruct_get_i_3pdangle_extloop (unsigned long*,
 int
 secstruct_calculate_DG (const char*, const NN_scores*, const SecStruct*);
 
+int
+secstruct_calculate_DG_int (const char*, const NN_int_scores*,
+                            const SecStruct*);
+
 /*********************************   Output   *********************************/
 
 void
@@ -39,16 +39,582 @@
  *  Revision History:
  *         - 2008Jul03 bienert: created
  *         - 2009Oct08 bienert: Added test for hashed tetra loops
+ *         - 2026Oct18 bienert: Added test for parameter files and images
+ *         - 2026Oct18 bienert: Added test for temperature rescaling
+ *         - 2026Oct18 bienert: Added test for noisy copies sharing tables
+ *         - 2026Oct18 bienert: Added test for renumbered standard tables
+ *         - 2026Oct18 bienert: Added test for batched lookups
  *
  */
 
 
 #include <config.h>
 #include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
 #include <libcrbbasic/crbbasic.h>
 #include "alphabet.h"
 #include "nn_scores.h"
 
+#define PAR_FILE "test_nn_scores.par"
+#define PAR_IMAGE PAR_FILE ".img"
+
+/* compare two schemes by their parameter file representation, each with its
+   own alphabet */
+static bool
+s_par_equal_in (const NN_scores* s1, const Alphabet* sigma1,
+                const NN_scores* s2, const Alphabet* sigma2)
+{
+   FILE* f1;
+   FILE* f2;
+   int c1, c2;
+
+   f1 = tmpfile ();
+   f2 = tmpfile ();
+   if ((f1 == NULL) || (f2 == NULL))
+   {
+      return false;
+   }
+
+   nn_scores_fprintf_par (f1, s1, sigma1);
+   nn_scores_fprintf_par (f2, s2, sigma2);
+   rewind (f1);
+   rewind (f2);
+
+   do {
+      c1 = fgetc (f1);
+      c2 = fgetc (f2);
+   } while ((c1 == c2) && (c1 != EOF));
+
+   fclose (f1);
+   fclose (f2);
+
+   return c1 == c2;
+}
+
+/* compare two schemes by their parameter file representation */
+static bool
+s_par_equal (const NN_scores* s1, const NN_scores* s2, const Alphabet* sigma)
+{
+   return s_par_equal_in (s1, sigma, s2, sigma);
+}
+
+/* write the standard parameters to a file and read them back, verbatim, via
+   the image and with an offset */
+static int
+s_test_par_file (NN_scores* scores, Alphabet* sigma)
+{
+   NN_scores* loaded;
+   NN_scores* ref;
+   FILE* par;
+   Rng rng;
+   char tloop[6];
+   int i, j;
+   int error = 0;
+
+   THROW_WARN_MSG ("Checking parameter files.");
+   unlink (PAR_FILE);
+   unlink (PAR_IMAGE);
+
+   par = fopen (PAR_FILE, "w");
+   if (par == NULL)
+   {
+      THROW_ERROR_MSG ("Could not write \"%s\"", PAR_FILE);
+      return 1;
+   }
+   nn_scores_fprintf_par (par, scores, sigma);
+   fclose (par);
+
+   /* first read parses the file and writes the image */
+   loaded = NN_SCORES_NEW_FROM_FILE (PAR_FILE, 0, sigma);
+   if ((loaded == NULL) || (! s_par_equal (scores, loaded, sigma)))
+   {
+      THROW_ERROR_MSG ("Parameters read from \"%s\" differ from the "
+                       "standard parameters", PAR_FILE);
+      error = 1;
+   }
+   nn_scores_delete (loaded);
+
+   if ((!error) && (access (PAR_IMAGE, R_OK) != 0))
+   {
+      THROW_ERROR_MSG ("No parameter image \"%s\" written", PAR_IMAGE);
+      error = 1;
+   }
+
+   /* second read maps the image, noise must not change it */
+   if (!error)
+   {
+      loaded = NN_SCORES_NEW_FROM_FILE (PAR_FILE, 0, sigma);
+      if ((loaded == NULL) || (! s_par_equal (scores, loaded, sigma)))
+      {
+         THROW_ERROR_MSG ("Parameters mapped from \"%s\" differ from the "
+                          "standard parameters", PAR_IMAGE);
+         error = 1;
+      }
+      else
+      {
+         rng_init (1, 0, &rng);
+         nn_scores_add_thermal_noise (alphabet_size (sigma), &rng, loaded);
+      }
+      nn_scores_delete (loaded);
+   }
+
+   /* offsets are applied as by the standard constructor */
+   if (!error)
+   {
+      ref = NN_SCORES_NEW_INIT (50, sigma);
+      loaded = NN_SCORES_NEW_FROM_FILE (PAR_FILE, 50, sigma);
+      if (  (ref == NULL) || (loaded == NULL)
+          ||(! s_par_equal (ref, loaded, sigma)))
+      {
+         error = 1;
+      }
+      for (i = 0; (!error) && (i < (int) alphabet_size (sigma)); i++)
+      {
+         for (j = 0; j < (int) alphabet_size (sigma); j++)
+         {
+            if (  nn_scores_get_nun_penalty (i, j, ref)
+                != nn_scores_get_nun_penalty (i, j, loaded))
+            {
+               error = 1;
+            }
+         }
+      }
+      if (error)
+      {
+         THROW_ERROR_MSG ("Parameters read with an offset differ from the "
+                          "standard parameters");
+      }
+      nn_scores_delete (ref);
+      nn_scores_delete (loaded);
+   }
+
+   /* a changed file replaces the image, missing sections stay standard */
+   par = fopen (PAR_FILE, "w");
+   if ((!error) && (par != NULL))
+   {
+      mfprintf (par, "# tetraloops\nUGAAAG -123 /* was -200 */\n# END\n");
+      fclose (par);
+
+      loaded = NN_SCORES_NEW_FROM_FILE (PAR_FILE, 0, sigma);
+      tloop[0] = alphabet_base_2_no ('U', sigma);
+      tloop[1] = alphabet_base_2_no ('G', sigma);
+      tloop[2] = alphabet_base_2_no ('A', sigma);
+      tloop[3] = alphabet_base_2_no ('A', sigma);
+      tloop[4] = alphabet_base_2_no ('A', sigma);
+      tloop[5] = alphabet_base_2_no ('G', sigma);
+      if (  (loaded == NULL)
+          ||(nn_scores_get_G_tetra_loop (tloop, 0, loaded) != -123.0f)
+          ||(  nn_scores_get_G_stack (tloop[0], tloop[5], tloop[0], tloop[5],
+                                      loaded)
+             != nn_scores_get_G_stack (tloop[0], tloop[5], tloop[0], tloop[5],
+                                       scores)))
+      {
+         THROW_ERROR_MSG ("Changed parameter file \"%s\" not read",
+                          PAR_FILE);
+         error = 1;
+      }
+      nn_scores_delete (loaded);
+   }
+
+   unlink (PAR_FILE);
+   unlink (PAR_IMAGE);
+
+   return error;
+}
+
+static int
+s_test_temperature (NN_scores* scores, Alphabet* sigma)
+{
+   NN_scores* copy;
+   NN_scores* ref;
+   NN_scores* derived;
+   const NN_scores* t37;
+   const NN_scores* t60;
+   const NN_scores* again;
+   char a, c, g, u;
+   float ratio, penalty;
+   int error = 0;
+
+   THROW_WARN_MSG ("Checking temperature rescaling.");
+
+   a = alphabet_base_2_no ('A', sigma);
+   c = alphabet_base_2_no ('C', sigma);
+   g = alphabet_base_2_no ('G', sigma);
+   u = alphabet_base_2_no ('U', sigma);
+
+   /* copies apply offsets as the standard constructor */
+   ref = NN_SCORES_NEW_INIT (50, sigma);
+   copy = NN_SCORES_NEW_COPY (scores, 50);
+   if (  (ref == NULL) || (copy == NULL)
+       ||(! s_par_equal (ref, copy, sigma))
+       ||(nn_scores_get_nun_penalty (a, a, ref)
+          != nn_scores_get_nun_penalty (a, a, copy)))
+   {
+      THROW_ERROR_MSG ("Copy of a scheme differs from the original");
+      error = 1;
+   }
+   nn_scores_delete (ref);
+   nn_scores_delete (copy);
+
+   /* nothing changes at 37 degree */
+   t37 = nn_scores_at_temperature (scores, NULL, 37.0f);
+   if ((!error) && ((t37 == NULL) || (! s_par_equal (scores, t37, sigma))))
+   {
+      THROW_ERROR_MSG ("Scheme derived for 37 degree differs from the "
+                       "original");
+      error = 1;
+   }
+
+   /* without enthalpies, stacks stay, loop penalties scale with T */
+   t60 = nn_scores_at_temperature (scores, NULL, 60.0f);
+   again = nn_scores_at_temperature (scores, NULL, 60.0f);
+   if ((!error) && ((t60 == NULL) || (t60 != again) || (t60 == t37)))
+   {
+      THROW_ERROR_MSG ("Schemes derived for a temperature are not shared");
+      error = 1;
+   }
+   if (!error)
+   {
+      ratio = (60.0f + 273.15f) / (37.0f + 273.15f);
+      penalty = nn_scores_get_G_non_gc_penalty_for_bp (a, u, scores);
+      if (  (nn_scores_get_temperature (t60) != 60.0f)
+          ||(  nn_scores_get_G_stack (g, c, g, c, t60)
+             != nn_scores_get_G_stack (g, c, g, c, scores))
+          ||(  fabsf (nn_scores_get_G_non_gc_penalty_for_bp (a, u, t60)
+                      - (penalty * ratio))
+             > 0.001f))
+      {
+         THROW_ERROR_MSG ("Scheme derived for 60 degree is not rescaled as "
+                          "expected");
+         error = 1;
+      }
+   }
+   nn_scores_at_temperature_release (again);
+   nn_scores_at_temperature_release (t60);
+   nn_scores_at_temperature_release (t37);
+
+   /* enthalpies equal to the free energies mean no entropy at all */
+   if (!error)
+   {
+      derived = NN_SCORES_NEW_AT_TEMPERATURE (scores, scores, 60.0f);
+      if ((derived == NULL) || (! s_par_equal (scores, derived, sigma)))
+      {
+         THROW_ERROR_MSG ("Scheme without entropies changes with "
+                          "temperature");
+         error = 1;
+      }
+      nn_scores_delete (derived);
+   }
+
+   return error;
+}
+
+/* copies sharing internal loop tables have to yield the very same energies
+   as copies with noise added */
+static int
+s_test_noisy_copy (NN_scores* scores, Alphabet* sigma)
+{
+   NN_scores* ref;
+   NN_scores* noisy;
+   NN_scores* copy = NULL;
+   Rng rng;
+   char i1, j1, i2, j2, a, b, c, d, asize;
+   unsigned long bp1, bp2;
+   int error = 0;
+
+   THROW_WARN_MSG ("Checking noisy copies sharing tables.");
+
+   rng_init (11, 0, &rng);
+   ref = NN_SCORES_NEW_COPY (scores, 50);
+   noisy = NN_SCORES_NEW_NOISY_COPY (scores, 50, &rng);
+   if ((ref == NULL) || (noisy == NULL))
+   {
+      THROW_ERROR_MSG ("Could not create noisy copies");
+      nn_scores_delete (ref);
+      nn_scores_delete (noisy);
+      return 1;
+   }
+   nn_scores_add_thermal_noise (alphabet_size (sigma), &rng, ref);
+
+   /* all parameters, including shared tables */
+   if (! s_par_equal (ref, noisy, sigma))
+   {
+      THROW_ERROR_MSG ("Parameters of a noisy copy differ from a copy with "
+                       "noise");
+      error = 1;
+   }
+
+   /* getters of shared tables */
+   asize = (signed) alphabet_size (sigma);
+   for (bp1 = 0; (bp1 < nn_scores_no_allowed_basepairs (scores)) && (!error);
+        bp1++)
+   {
+      nn_scores_get_allowed_basepair (bp1, &i1, &j1, scores);
+      for (bp2 = 0; bp2 < nn_scores_no_allowed_basepairs (scores); bp2++)
+      {
+         nn_scores_get_allowed_basepair (bp2, &j2, &i2, scores);
+         for (a = 0; a < asize; a++)
+         {
+            for (b = 0; b < asize; b++)
+            {
+               if (  nn_scores_get_G_internal_1x1_loop (i1, j1, a, b, i2, j2,
+                                                        ref)
+                   !=nn_scores_get_G_internal_1x1_loop (i1, j1, a, b, i2, j2,
+                                                        noisy))
+               {
+                  error = 1;
+               }
+               for (c = 0; c < asize; c++)
+               {
+                  if (  nn_scores_get_G_internal_1x2_loop (i1, j1, a, b, c,
+                                                           j2, i2, ref)
+                      !=nn_scores_get_G_internal_1x2_loop (i1, j1, a, b, c,
+                                                           j2, i2, noisy))
+                  {
+                     error = 1;
+                  }
+                  for (d = 0; d < asize; d++)
+                  {
+                     if (  nn_scores_get_G_internal_2x2_loop (i1, j1, a, b,
+                                                              j2, i2, c, d,
+                                                              ref)
+                         !=nn_scores_get_G_internal_2x2_loop (i1, j1, a, b,
+                                                              j2, i2, c, d,
+                                                              noisy))
+                     {
+                        error = 1;
+                     }
+                  }
+               }
+            }
+         }
+      }
+      if (error)
+      {
+         THROW_ERROR_MSG ("Internal loop energies of a noisy copy differ "
+                          "from a copy with noise");
+      }
+   }
+
+   /* copies store offset and noise of shared tables */
+   if (!error)
+   {
+      copy = NN_SCORES_NEW_COPY (noisy, 0);
+      if ((copy == NULL) || (! s_par_equal (ref, copy, sigma)))
+      {
+         THROW_ERROR_MSG ("Copy of a noisy copy differs from a copy with "
+                          "noise");
+         error = 1;
+      }
+   }
+
+   nn_scores_delete (copy);
+   nn_scores_delete (noisy);
+   nn_scores_delete (ref);
+
+   return error;
+}
+
+/* standard tables rearranged for another numbering of the bases have to hold
+   the same parameters */
+static int
+s_test_renumber (NN_scores* scores, Alphabet* sigma)
+{
+   Alphabet* other;
+   NN_scores* renumbered = NULL;
+   const char* rna = "ACGU";
+   int i, j;
+   int error = 0;
+
+   THROW_WARN_MSG ("Checking standard tables for another alphabet.");
+
+   other = ALPHABET_NEW_PAIR ("AUGC", "augc", 4);
+   if (other != NULL)
+   {
+      renumbered = NN_SCORES_NEW_INIT (0, other);
+   }
+   if (  (renumbered == NULL)
+       ||(! s_par_equal_in (scores, sigma, renumbered, other)))
+   {
+      THROW_ERROR_MSG ("Standard tables for alphabet \"AUGC\" differ from "
+                       "the ones for \"ACGU\"");
+      error = 1;
+   }
+
+   for (i = 0; (i < 4) && (!error); i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         if (  nn_scores_get_nun_penalty (
+                  alphabet_base_2_no (rna[i], sigma),
+                  alphabet_base_2_no (rna[j], sigma), scores)
+             !=nn_scores_get_nun_penalty (
+                  alphabet_base_2_no (rna[i], other),
+                  alphabet_base_2_no (rna[j], other), renumbered))
+         {
+            THROW_ERROR_MSG ("Penalty for non-unitable nucleotides %c%c "
+                             "differs for alphabet \"AUGC\"", rna[i],
+                             rna[j]);
+            error = 1;
+         }
+      }
+   }
+
+   nn_scores_delete (renumbered);
+   alphabet_delete (other);
+
+   return error;
+}
+
+/* bases picked from a loop i1, j1, j2, i2, a, b, c, d for the batched
+   lookups: 1x1, 1x2, 2x2 */
+#define N_BATCHED 3
+static const unsigned long batch_width[N_BATCHED] = { 6, 7, 8 };
+static const int batch_pick[N_BATCHED][8] = {
+   { 0, 1, 4, 5, 3, 2 },
+   { 0, 1, 4, 5, 6, 2, 3 },
+   { 0, 1, 4, 5, 2, 3, 6, 7 }
+};
+
+static float
+s_single_lookup (const int kind, const char* t, const NN_scores* scores)
+{
+   switch (kind)
+   {
+      case 0:
+         return nn_scores_get_G_internal_1x1_loop (t[0], t[1], t[2], t[3],
+                                                   t[4], t[5], scores);
+      case 1:
+         return nn_scores_get_G_internal_1x2_loop (t[0], t[1], t[2], t[3],
+                                                   t[4], t[5], t[6], scores);
+      default:
+         return nn_scores_get_G_internal_2x2_loop (t[0], t[1], t[2], t[3],
+                                                   t[4], t[5], t[6], t[7],
+                                                   scores);
+   }
+}
+
+static void
+s_batched_lookup (const int kind, const char* t, const unsigned long n,
+                  float* G, const NN_scores* scores)
+{
+   switch (kind)
+   {
+      case 0:
+         nn_scores_get_G_internal_1x1_loop_n (t, n, G, scores);
+         break;
+      case 1:
+         nn_scores_get_G_internal_1x2_loop_n (t, n, G, scores);
+         break;
+      default:
+         nn_scores_get_G_internal_2x2_loop_n (t, n, G, scores);
+   }
+}
+
+/* batched lookups have to yield the same energies as single lookups, for
+   loops closed by all allowed base pairs */
+static int
+s_test_batched_in (const NN_scores* scores, const Alphabet* sigma)
+{
+   unsigned long nbp, asize, n, k;
+   unsigned long b;
+   char* loops;
+   char* tuples;
+   float* G;
+   int kind, p;
+   int error = 0;
+
+   nbp = nn_scores_no_allowed_basepairs (scores);
+   asize = alphabet_size (sigma);
+   n = nbp * nbp * asize * asize * asize * asize;
+
+   loops = XMALLOC (n * 8 * sizeof (*loops));
+   tuples = XMALLOC (n * 8 * sizeof (*tuples));
+   G = XMALLOC (n * sizeof (*G));
+   if ((loops == NULL) || (tuples == NULL) || (G == NULL))
+   {
+      XFREE (loops);
+      XFREE (tuples);
+      XFREE (G);
+      return 1;
+   }
+
+   /* a, b, c, d enumerated, i1, j1 and j2, i2 from the base pairs */
+   for (k = 0; k < n; k++)
+   {
+      b = k;
+      for (p = 7; p > 3; p--)
+      {
+         loops[k * 8 + p] = (char) (b % asize);
+         b /= asize;
+      }
+      nn_scores_get_allowed_basepair (b / nbp, &loops[k * 8],
+                                      &loops[k * 8 + 1], scores);
+      nn_scores_get_allowed_basepair (b % nbp, &loops[k * 8 + 2],
+                                      &loops[k * 8 + 3], scores);
+   }
+
+   for (kind = 0; (kind < N_BATCHED) && (!error); kind++)
+   {
+      for (k = 0; k < n; k++)
+      {
+         for (b = 0; b < batch_width[kind]; b++)
+         {
+            tuples[k * batch_width[kind] + b] =
+               loops[k * 8 + batch_pick[kind][b]];
+         }
+      }
+
+      s_batched_lookup (kind, tuples, n, G, scores);
+
+      for (k = 0; (k < n) && (!error); k++)
+      {
+         if (G[k] != s_single_lookup (kind, &tuples[k * batch_width[kind]],
+                                      scores))
+         {
+            THROW_ERROR_MSG ("Batched lookup %d differs from single lookup "
+                             "for tuple %lu", kind, k);
+            error = 1;
+         }
+      }
+   }
+
+   XFREE (loops);
+   XFREE (tuples);
+   XFREE (G);
+
+   return error;
+}
+
+static int
+s_test_batched (NN_scores* scores, Alphabet* sigma)
+{
+   NN_scores* noisy;
+   Rng rng;
+   int error;
+
+   THROW_WARN_MSG ("Checking batched lookups.");
+
+   error = s_test_batched_in (scores, sigma);
+
+   /* shared tables get offset and noise on access */
+   if (!error)
+   {
+      rng_init (13, 0, &rng);
+      noisy = NN_SCORES_NEW_NOISY_COPY (scores, 50, &rng);
+      if (noisy == NULL)
+      {
+         THROW_ERROR_MSG ("Could not create noisy copy");
+         return 1;
+      }
+      error = s_test_batched_in (noisy, sigma);
+      nn_scores_delete (noisy);
+   }
+
+   return error;
+}
+
 int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
 {
 
@@ -113,13 +679,10 @@ int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
    nn_scores_fprintf_nun_penalties (stdout, scores, sigma);
    mprintf ("Tetra loop bonus energies:\n");
    nn_scores_fprintf_tetra_loop(stdout, scores, sigma);
-   mprintf ("Tetra loop hash function:\n");
-   nn_scores_fprintf_tetra_loop_hashfunction(stdout, scores, sigma);
 
    /* SB 09-10-08 START 
-    * Testing the tetra loop hashfunction. If the function stops working,
-    * modify nn_scores.c according to the instruction written therein and
-    * comment out this test.
+    * Testing the tetra loop index: only the 30 parameterised loops may get a
+    * bonus score.
     */
    THROW_WARN_MSG ("Checking tetra loop scores.");
    asize = (signed) alphabet_size (sigma);
@@ -194,6 +757,18 @@ int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
    }
    /* SB 09-10-08 END */
 
+   if (  s_test_par_file (scores, sigma) || s_test_temperature (scores, sigma)
+       ||s_test_noisy_copy (scores, sigma) || s_test_renumber (scores, sigma)
+       ||s_test_batched (scores, sigma))
+   {
+      alphabet_delete (sigma);
+      nn_scores_delete (scores);
+
+      FREE_MEMORY_MANAGER;
+
+      return EXIT_FAILURE;
+   }
+
    alphabet_delete (sigma);
    nn_scores_delete (scores);
 
@@ -38,6 +38,7 @@
  *
  *  Revision History:
  *         - 2008Sep16 bienert: created
+ *         - 2026Oct18 bienert: Added test for integer energy evaluation
  *
  */
 
@@ -45,9 +46,138 @@
 #include <config.h>
 #include <stdlib.h>
 #include <libcrbbasic/crbbasic.h>
+#include "alphabet.h"
+#include "nn_scores.h"
 #include "rna.h"
 #include "secstruct.h"
 
+/* compare integer and float evaluation of a structure */
+static int
+s_compare_DG (const char* seq, const char* structure, const NN_scores* scores,
+              Alphabet* sigma)
+{
+   Rna* rna;
+   NN_int_scores* int_scores;
+   int error, G, G_int;
+
+   rna = RNA_NEW;
+   if (rna == NULL)
+   {
+      return 1;
+   }
+
+   error = RNA_INIT_SEQUENCE_STRUCTURE(seq, structure, strlen (seq), sigma,
+                                       rna);
+   if (! error)
+   {
+      error = RNA_SECSTRUCT_INIT (rna);
+   }
+
+   if (! error)
+   {
+      int_scores = NN_INT_SCORES_NEW (scores, rna_get_size (rna));
+      if (int_scores == NULL)
+      {
+         error = 1;
+      }
+   }
+
+   if (! error)
+   {
+      G = secstruct_calculate_DG (rna_get_sequence (rna), scores,
+                                  rna_get_secstruct (rna));
+      G_int = secstruct_calculate_DG_int (rna_get_sequence (rna), int_scores,
+                                          rna_get_secstruct (rna));
+      if (G != G_int)
+      {
+         THROW_ERROR_MSG ("Integer evaluation of \"%s\" for \"%s\" yields %d, "
+                          "float evaluation %d.", structure, seq, G_int, G);
+         error = 1;
+      }
+      nn_int_scores_delete (int_scores);
+   }
+
+   rna_delete (rna);
+
+   return error;
+}
+
+/* evaluate structures with integer tables, including loops beyond the
+   tabulated sizes, for random sequences */
+static int
+s_test_integer_DG (void)
+{
+   const char* structures[] = {
+      "..(((...(((...)))...(((...(((...)))...(((...((((((.....))).....)))"
+      ".....)))...(((...)))...)))...(((...)))...)))",
+      "((((........................................))))",
+      "(((....................((((....))))...............)))",
+      "(((...................................((((....)))))))",
+      "(((.((((....)))).)))..(((..((((....))))..)))..(((..((((....)))).)))",
+      "((((.((((....)))).))))..((((((((....)))..)))))..((((....))))",
+   };
+   const char* pairs[] = { "CG", "GC", "AU", "UA", "GU", "UG" };
+   const char* bases = "ACGU";
+   const char* pair;
+   unsigned long i, j, k, n, stack[64], sp;
+   char seq[128];
+   int error = 0;
+   Alphabet* sigma;
+   NN_scores* scores;
+
+   sigma = ALPHABET_NEW_SINGLE (RNA_ALPHABET, strlen (RNA_ALPHABET) / 2);
+   if (sigma == NULL)
+   {
+      return 1;
+   }
+
+   scores = NN_SCORES_NEW_INIT(0, sigma);
+   if (scores == NULL)
+   {
+      alphabet_delete (sigma);
+      return 1;
+   }
+
+   /* tetraloop with bonus */
+   error = s_compare_DG ("GGCUGAAAGGCC", "((((....))))", scores, sigma);
+
+   srand (42);
+   for (i = 0; (i < sizeof (structures) / sizeof (*structures)) && (! error);
+        i++)
+   {
+      n = strlen (structures[i]);
+      for (j = 0; (j < 50) && (! error); j++)
+      {
+         sp = 0;
+         for (k = 0; k < n; k++)
+         {
+            if (structures[i][k] == '(')
+            {
+               stack[sp++] = k;
+            }
+            else if (structures[i][k] == ')')
+            {
+               sp--;
+               pair = pairs[rand () % 6];
+               seq[stack[sp]] = pair[0];
+               seq[k] = pair[1];
+            }
+            else
+            {
+               seq[k] = bases[rand () % 4];
+            }
+         }
+         seq[n] = '\0';
+         error = s_compare_DG (seq, structures[i], scores, sigma);
+      }
+   }
+
+   nn_scores_delete (scores);
+   alphabet_delete (sigma);
+
+   return error;
+}
+
 int main(int argc __attribute__((unused)),char *argv[] __attribute__((unused)))
 {
    unsigned long i1, j1, i2, j2, size1, size2;
@@ -606,6 +736,12 @@ secstruct_get_geometry_internal (&i1, &j1, &i2, &j2, &size1, &size2, 0,
    secstruct_delete (structure);
    rna_delete (rna);
 
+   /* integer evaluation */
+   if (s_test_integer_DG ())
+   {
+      return EXIT_FAILURE;
+   }
+
    FREE_MEMORY_MANAGER;
 
    return EXIT_SUCCESS;